@@ -455,6 +455,72 @@ class Generator:
         for info in node_infos:
             self._gen_hash_function_def(info)
 
+    def _get_compact_node_infos(self) -> List[_PrinterNodeInfo]:
+        node_infos: List[Generator._PrinterNodeInfo] = []
+        typename_stack = []
+        for node in self.schema.ast:
+            Generator._get_node_infos(node, node_infos, typename_stack)
+
+        return [info for info in node_infos if not info.is_enum]
+
+    def _gen_compact_node_signature(self, info: _PrinterNodeInfo):
+        attr = ""
+        if len(info.fields) == 0:
+            attr = "[[maybe_unused]] "
+
+        self._indent()
+        self.out.write(
+            f"{info.type} compact_node(\
+const {info.type}& n, {attr}Compactor& c)"
+        )
+
+    def _gen_compact_node_fwds(self):
+        for info in self._get_compact_node_infos():
+            self._gen_compact_node_signature(info)
+            self.out.write(";\n")
+
+    def _gen_compact_node_defs(self):
+        for info in self._get_compact_node_infos():
+            self._gen_compact_node_signature(info)
+            self.out.write(" {\n")
+            self.indent += 1
+            self._indent()
+            if len(info.fields) == 0:
+                self.out.write("return n;\n")
+            else:
+                # Braced initialization copies the fields in order
+                copies = ", ".join(f"c.copy(n.{field})" for field in info.fields)
+                self.out.write(f"return {{ {copies} }};\n")
+            self.indent -= 1
+            self._indent()
+            self.out.write("}\n")
+
+    def _gen_node_kinds(self):
+        node_infos: List[Generator._PrinterNodeInfo] = []
+        typename_stack = []
+        for node in self.schema.ast:
+            Generator._get_node_infos(node, node_infos, typename_stack)
+
+        structs = [info for info in node_infos if not info.is_enum]
+
+        self.out.write(f"namespace {self.schema.namespace}::util {{\n\n")
+
+        for index, info in enumerate(structs):
+            self.out.write("template<>\n")
+            self.out.write(f"struct NodeKind<{info.type}> {{\n")
+            self.out.write(f"static constexpr std::size_t index = {index};\n")
+            self.out.write("};\n")
+
+        self.out.write(
+            f"inline constexpr std::size_t NODE_KIND_COUNT = {len(structs)};\n"
+        )
+        self.out.write("inline constexpr std::string_view NODE_KIND_NAMES[] = {\n")
+        for info in structs:
+            self.out.write(f'"{info.type}",\n')
+        self.out.write("};\n")
+
+        self.out.write("\n}\n")
+
     def _gen_header(self):
         self._gen_heading()
 
@@ -487,6 +553,9 @@ class Generator:
         for node in self.schema.ast:
             self._gen_equality_forward_decl(node, True)
 
+        # Forward declarations for compaction, see `Compactor`
+        self._gen_compact_node_fwds()
+
         self._gen_printer()
 
         self.indent -= 1
@@ -496,7 +565,9 @@ class Generator:
 
         self._gen_hash_function_fwds()
 
-        self.out.write("\n}\n")
+        self.out.write("\n}\n\n")
+
+        self._gen_node_kinds()
 
     def _gen_source(self):
         self._gen_heading()
@@ -513,6 +584,9 @@ class Generator:
         for node in self.schema.ast:
             self._gen_equality_decl(node, True)
 
+        # Definitions for compaction
+        self._gen_compact_node_defs()
+
         self.indent -= 1
         self.out.write("\n}\n")
 
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <sys/resource.h>
+
+namespace alvo::bench {
+
+    struct Stats {
+        double ms;
+        long minor_faults;
+        long major_faults;
+    };
+
+    template<typename F>
+    Stats measure(F&& f) {
+        rusage usage_before;
+        rusage usage_after;
+        getrusage(RUSAGE_SELF, &usage_before);
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto end = std::chrono::steady_clock::now();
+        getrusage(RUSAGE_SELF, &usage_after);
+        return Stats {
+            .ms = std::chrono::duration<double, std::milli>(end - start)
+                      .count(),
+            .minor_faults = usage_after.ru_minflt - usage_before.ru_minflt,
+            .major_faults = usage_after.ru_majflt - usage_before.ru_majflt,
+        };
+    }
+
+    void report(std::string_view name, const Stats& stats);
+
+    // Generates a syntactically valid module of roughly `size` bytes
+    std::string make_module(std::size_t size);
+
+    void run_mem();
+
+    void run_lex();
+
+    void run_utf8();
+
+}
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "bench.h"
+#include "lex.h"
+#include "mem.h"
+#include "source.h"
+#include "sym.h"
+#include "tok.h"
+
+namespace alvo::bench {
+
+    static constexpr std::size_t MODULE_SIZE = 50 * 1024 * 1024;
+
+    static constexpr std::size_t RELEX_STEPS = 100;
+
+    void run_lex() {
+        fmt::println("== lex: lexing a {} B module ==",
+            fmt::group_digits(MODULE_SIZE));
+        source::SourceFile source(make_module(MODULE_SIZE));
+
+        std::size_t tok_count = 0;
+        Stats lex_stats = measure([&]() {
+            mem::Arena symbol_arena(4096);
+            sym::SymbolTable symbols(symbol_arena);
+            lex::Lexer lexer(source, symbols, symbol_arena);
+            while (!lexer.next().is_eof()) {
+                tok_count++;
+            }
+        });
+        report("lex all tokens", lex_stats);
+
+        std::size_t buffer_size = 0;
+        Stats buffer_stats = measure([&]() {
+            mem::Arena symbol_arena(4096);
+            sym::SymbolTable symbols(symbol_arena);
+            lex::Lexer lexer(source, symbols, symbol_arena);
+            lex::TokenBuffer tokens = lexer.tokenize_all();
+            buffer_size = tokens.get_memory_usage();
+        });
+        report("tokenize_all into a TokenBuffer", buffer_stats);
+
+        std::size_t emitted = 0;
+        auto count_tok = [&](const tok::Tok&) { emitted++; };
+        lex::TokEmitter tok_emitter(count_tok);
+        Stats emit_stats = measure([&]() {
+            mem::Arena symbol_arena(4096);
+            sym::SymbolTable symbols(symbol_arena);
+            lex::Lexer lexer(source, symbols, symbol_arena);
+            lexer.set_tok_emitter(tok_emitter);
+            lex::TokenBuffer tokens = lexer.tokenize_all();
+        });
+        report("tokenize_all with a token emitter", emit_stats);
+
+        std::size_t thread_count =
+            std::max(std::thread::hardware_concurrency(), 1u);
+        Stats parallel_stats = measure([&]() {
+            mem::Arena symbol_arena(4096);
+            sym::SymbolTable symbols(symbol_arena);
+            lex::TokenBuffer tokens =
+                lex::Lexer::tokenize_parallel(
+                    source, symbols, symbol_arena, thread_count);
+        });
+        report(fmt::format("tokenize_parallel in {} chunks", thread_count),
+            parallel_stats);
+
+        // A keystroke in the middle of the module and its undo, then the
+        // same at the start, so the gap moves across half the tokens
+        std::size_t middle = source.get_src().find('\n', MODULE_SIZE / 2);
+        source::SourceFile with_x = source.edited(middle, middle, " x");
+        source::SourceFile with_space = source.edited(0, 0, " ");
+        struct Step {
+            lex::Edit edit;
+            const source::SourceFile* result;
+        };
+        Step steps[] = {
+            { { middle, middle, " x" }, &with_x },
+            { { middle, middle + 2, "" }, &source },
+            { { 0, 0, " " }, &with_space },
+            { { 0, 1, "" }, &source },
+        };
+        mem::Arena relex_arena(4096);
+        sym::SymbolTable relex_symbols(relex_arena);
+        lex::Lexer relex_lexer(source, relex_symbols, relex_arena);
+        lex::TokenBuffer tokens = relex_lexer.tokenize_all();
+        // The first edit opens the gap, which reallocates the token arrays
+        for (const Step& step : { steps[0], steps[1] }) {
+            lex::Lexer::relex(tokens, *step.result, step.edit, relex_symbols);
+        }
+        Stats relex_stats = measure([&]() {
+            for (std::size_t i = 0; i < RELEX_STEPS; i++) {
+                const Step& step = steps[i % 2];
+                lex::Lexer::relex(
+                    tokens, *step.result, step.edit, relex_symbols);
+            }
+        });
+        report(fmt::format("relex {} one-line edits", RELEX_STEPS),
+            relex_stats);
+        Stats far_relex_stats = measure([&]() {
+            for (std::size_t i = 0; i < RELEX_STEPS; i++) {
+                const Step& step = steps[i % 4];
+                lex::Lexer::relex(
+                    tokens, *step.result, step.edit, relex_symbols);
+            }
+        });
+        report(fmt::format("relex {} edits half a module apart", RELEX_STEPS),
+            far_relex_stats);
+
+        // Doc comments and string tables, where most bytes are skipped over
+        std::string text_src;
+        while (text_src.size() < MODULE_SIZE / 4) {
+            text_src += "// Returns the name of the entry, or an empty string "
+                        "when the table has none\n"
+                        "let name = \"a fairly long table entry with a \\t tab "
+                        "and plain text after it\";\n";
+        }
+        source::SourceFile text_source(text_src);
+        Stats text_stats = measure([&]() {
+            mem::Arena symbol_arena(4096);
+            sym::SymbolTable symbols(symbol_arena);
+            lex::Lexer lexer(text_source, symbols, symbol_arena);
+            lex::TokenBuffer tokens = lexer.tokenize_all();
+        });
+        report("tokenize_all over comments and strings", text_stats);
+
+        double mb = (double)source.get_src().size() / (1024.0 * 1024.0);
+        fmt::println("{} tokens, {:.1f} MiB/s", fmt::group_digits(tok_count),
+            mb / (lex_stats.ms / 1000.0));
+        fmt::println("parallel: {:.1f} MiB/s ({:.2f}x)",
+            mb / (parallel_stats.ms / 1000.0),
+            buffer_stats.ms / parallel_stats.ms);
+        fmt::println("token emitter: {} tokens, {:+.1f}% over no emitter",
+            fmt::group_digits(emitted),
+            (emit_stats.ms / buffer_stats.ms - 1.0) * 100.0);
+        fmt::println("comments and strings: {:.1f} MiB/s",
+            (double)text_source.get_src().size() / (1024.0 * 1024.0) /
+                (text_stats.ms / 1000.0));
+        fmt::println("token memory: {} B as tok::Tok, {} B in a TokenBuffer",
+            fmt::group_digits(tok_count * sizeof(tok::Tok)),
+            fmt::group_digits(buffer_size));
+    }
+
+}
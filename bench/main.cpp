@@ -0,0 +1,58 @@
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include "bench.h"
+
+namespace alvo::bench {
+
+    void report(std::string_view name, const Stats& stats) {
+        fmt::println("{:<40} {:>10.2f} ms {:>12} minflt {:>6} majflt", name,
+            stats.ms, fmt::group_digits(stats.minor_faults),
+            stats.major_faults);
+    }
+
+    std::string make_module(std::size_t size) {
+        std::string res;
+        res.reserve(size + 512);
+        std::size_t i = 0;
+        while (res.size() < size) {
+            res += fmt::format(
+                "// Generated declaration #{}\n"
+                "Point{} :: struct {{ x: int, y: int, name: string }}\n"
+                "func{} :: func(a: int, b: float, p: Point{}) -> int {{\n"
+                "    let x: int = a + 42 * (b as int) - 0x1f;\n"
+                "    let s = \"string literal {}\";\n"
+                "    if x >= 10 && !false {{\n"
+                "        x += p.x * 2;\n"
+                "    }} elif x == 0 {{\n"
+                "        return func{}(x, 1.5, p);\n"
+                "    }} else {{\n"
+                "        x = [1, 2, 3][1] + tup(1, 'c')[0];\n"
+                "    }}\n"
+                "    for i: [0, 1, 2] {{ x -= i; }}\n"
+                "    return x;\n"
+                "}}\n\n",
+                i, i, i, i, i, i);
+            i++;
+        }
+        return res;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    std::string_view filter = argc > 1 ? argv[1] : "";
+
+    if (filter.empty() || filter == "mem") {
+        alvo::bench::run_mem();
+    }
+    if (filter.empty() || filter == "lex") {
+        alvo::bench::run_lex();
+    }
+    if (filter.empty() || filter == "utf8") {
+        alvo::bench::run_utf8();
+    }
+
+    return 0;
+}
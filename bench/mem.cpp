@@ -0,0 +1,68 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "bench.h"
+#include "lex.h"
+#include "parse.h"
+#include "mem.h"
+#include "source.h"
+#include "sym.h"
+
+namespace alvo::bench {
+
+    static constexpr std::size_t MODULE_SIZE = 50 * 1024 * 1024;
+    // Above the size from which blocks are mapped with anonymous `mmap`, so
+    // untouched pages are zero pages from the OS
+    static constexpr std::size_t BLOCK_SIZE = 1024 * 1024;
+
+    // Parses `tokens` into an arena that takes its blocks from `pool`,
+    // returns the number of blocks it used
+    static std::size_t _parse(
+        const lex::TokenBuffer& tokens, mem::BlockPool& pool) {
+        mem::Arena arena(BLOCK_SIZE);
+        arena.set_block_pool(pool);
+        parse::Parser parser(tokens, arena);
+        parser.parse_module();
+        return arena.get_block_count();
+    }
+
+    void run_mem() {
+        fmt::println("== mem: parsing a {} B module ==",
+            fmt::group_digits(MODULE_SIZE));
+        source::SourceFile source(make_module(MODULE_SIZE));
+        mem::Arena symbol_arena(BLOCK_SIZE);
+        sym::SymbolTable symbols(symbol_arena);
+        lex::Lexer lexer(source, symbols, symbol_arena);
+        lex::TokenBuffer tokens = lexer.tokenize_all();
+
+        // Both runs parse through a pool, the lazy one starts with it empty
+        // so every block is freshly mapped
+        std::size_t block_count = 0;
+        Stats lazy_stats = measure([&]() {
+            mem::BlockPool pool(SIZE_MAX);
+            block_count = _parse(tokens, pool);
+        });
+
+        // Zero-fills every block on creation, as blocks used to be, and
+        // hands them to the parse through the pool
+        Stats eager_stats = measure([&]() {
+            mem::BlockPool pool(SIZE_MAX);
+            for (std::size_t i = 0; i < block_count; i++) {
+                mem::ArenaBlock block(BLOCK_SIZE);
+                std::memset(block.alloc(BLOCK_SIZE, 1), 0, BLOCK_SIZE);
+                pool.release(std::move(block));
+            }
+            _parse(tokens, pool);
+        });
+
+        report("parse, blocks zeroed up front", eager_stats);
+        report("parse, blocks not zeroed up front", lazy_stats);
+        fmt::println("arena: {} blocks of {} B", fmt::group_digits(block_count),
+            fmt::group_digits(BLOCK_SIZE));
+    }
+
+}
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "bench.h"
+#include "utf8.h"
+
+namespace alvo::bench {
+
+    static constexpr std::size_t SAMPLE_COUNT = 1 << 20;
+    static constexpr int ROUNDS = 20;
+
+    // Sorted ranges of `is_alpha`, searched the way the compiler lowers a
+    // large sparse `switch`
+    class RangeSet {
+    public:
+        RangeSet(bool (*pred)(utf8::Codepoint)) {
+            utf8::Codepoint start = -1;
+            for (utf8::Codepoint c = 0; c <= 0x110000; c++) {
+                bool in = c < 0x110000 && pred(c);
+                if (in && start < 0) {
+                    start = c;
+                } else if (!in && start >= 0) {
+                    m_ranges.emplace_back(start, c - 1);
+                    start = -1;
+                }
+            }
+        }
+
+        bool contains(utf8::Codepoint c) const {
+            auto it = std::upper_bound(m_ranges.begin(), m_ranges.end(), c,
+                [](utf8::Codepoint c, const auto& range) {
+                    return c < range.first;
+                });
+            return it != m_ranges.begin() && c <= std::prev(it)->second;
+        }
+
+    private:
+        std::vector<std::pair<utf8::Codepoint, utf8::Codepoint>> m_ranges;
+    };
+
+    static std::vector<utf8::Codepoint> make_samples(
+        utf8::Codepoint first, utf8::Codepoint last) {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<utf8::Codepoint> dist(first, last);
+        std::vector<utf8::Codepoint> res(SAMPLE_COUNT);
+        for (auto& c : res) {
+            c = dist(rng);
+        }
+        return res;
+    }
+
+    template<typename F>
+    static void run_case(std::string_view name,
+        const std::vector<utf8::Codepoint>& samples, F&& pred) {
+        std::size_t count = 0;
+        Stats stats = measure([&]() {
+            for (int round = 0; round < ROUNDS; round++) {
+                for (utf8::Codepoint c : samples) {
+                    count += pred(c);
+                }
+            }
+        });
+        double ns = stats.ms * 1e6 / (double)(SAMPLE_COUNT * ROUNDS);
+        fmt::println("{:<40} {:>10.2f} ms {:>8.2f} ns/call ({} hits)", name,
+            stats.ms, ns, fmt::group_digits(count));
+    }
+
+    void run_utf8() {
+        fmt::println("== utf8: is_alpha on {} codepoints x {} ==",
+            fmt::group_digits(SAMPLE_COUNT), ROUNDS);
+        RangeSet ranges(utf8::is_alpha);
+
+        std::pair<std::string_view, std::vector<utf8::Codepoint>> inputs[] = {
+            { "ASCII", make_samples(0x20, 0x7E) },
+            { "BMP", make_samples(0x80, 0xFFFF) },
+            { "all planes", make_samples(0, 0x10FFFF) },
+        };
+        for (const auto& [input, samples] : inputs) {
+            run_case(fmt::format("{}: two-stage table", input), samples,
+                [](utf8::Codepoint c) { return utf8::is_alpha(c); });
+            run_case(fmt::format("{}: range binary search", input), samples,
+                [&](utf8::Codepoint c) { return ranges.contains(c); });
+        }
+    }
+
+}
@@ -725,6 +725,354 @@ namespace alvo::ast {
         return l.top_levels != r.top_levels;
     }
 
+    Invalid compact_node(const Invalid& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    PathSegment compact_node(const PathSegment& n, Compactor& c) {
+        return { c.copy(n.val) };
+    }
+
+    PathSegment::Root compact_node(
+        const PathSegment::Root& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    PathSegment::Super compact_node(
+        const PathSegment::Super& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    PathSegment::Name compact_node(const PathSegment::Name& n, Compactor& c) {
+        return { c.copy(n.value), c.copy(n.generic_params) };
+    }
+
+    Import compact_node(const Import& n, Compactor& c) {
+        return { c.copy(n.kind), c.copy(n.segments) };
+    }
+
+    Import::Normal compact_node(
+        const Import::Normal& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Import::Glob compact_node(
+        const Import::Glob& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Import::Renamed compact_node(const Import::Renamed& n, Compactor& c) {
+        return { c.copy(n.renamed_to) };
+    }
+
+    Type compact_node(const Type& n, Compactor& c) {
+        return { c.copy(n.val), c.copy(n.nullable) };
+    }
+
+    Type::Unit compact_node(
+        const Type::Unit& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Type::String compact_node(
+        const Type::String& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Type::Char compact_node(
+        const Type::Char& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Type::Int compact_node(const Type::Int& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Type::Byte compact_node(
+        const Type::Byte& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Type::Float compact_node(
+        const Type::Float& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Type::Bool compact_node(
+        const Type::Bool& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Type::Array compact_node(const Type::Array& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.type) };
+    }
+
+    Type::Tup compact_node(const Type::Tup& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.types) };
+    }
+
+    Type::Func compact_node(const Type::Func& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.params),
+            c.copy(n.return_type) };
+    }
+
+    Type::Path compact_node(const Type::Path& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.segments) };
+    }
+
+    Type::Ref compact_node(const Type::Ref& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.type) };
+    }
+
+    Expr compact_node(const Expr& n, Compactor& c) {
+        return { c.copy(n.val) };
+    }
+
+    Expr::Literal compact_node(const Expr::Literal& n, Compactor& c) {
+        return { c.copy(n.val) };
+    }
+
+    Expr::Literal::Unit compact_node(
+        const Expr::Literal::Unit& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Expr::Literal::Null compact_node(
+        const Expr::Literal::Null& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Expr::Literal::String compact_node(
+        const Expr::Literal::String& n, Compactor& c) {
+        return { c.copy(n.value) };
+    }
+
+    Expr::Literal::Character compact_node(
+        const Expr::Literal::Character& n, Compactor& c) {
+        return { c.copy(n.value) };
+    }
+
+    Expr::Literal::Integer compact_node(
+        const Expr::Literal::Integer& n, Compactor& c) {
+        return { c.copy(n.value) };
+    }
+
+    Expr::Literal::Byte compact_node(
+        const Expr::Literal::Byte& n, Compactor& c) {
+        return { c.copy(n.value) };
+    }
+
+    Expr::Literal::Floating compact_node(
+        const Expr::Literal::Floating& n, Compactor& c) {
+        return { c.copy(n.value) };
+    }
+
+    Expr::Literal::Boolean compact_node(
+        const Expr::Literal::Boolean& n, Compactor& c) {
+        return { c.copy(n.value) };
+    }
+
+    Expr::Literal::Array compact_node(
+        const Expr::Literal::Array& n, Compactor& c) {
+        return { c.copy(n.val) };
+    }
+
+    Expr::Literal::Array::Regular compact_node(
+        const Expr::Literal::Array::Regular& n, Compactor& c) {
+        return { c.copy(n.elements) };
+    }
+
+    Expr::Literal::Array::DefaultNTimes compact_node(
+        const Expr::Literal::Array::DefaultNTimes& n, Compactor& c) {
+        return { c.copy(n.times) };
+    }
+
+    Expr::Literal::Array::ExprNTimes compact_node(
+        const Expr::Literal::Array::ExprNTimes& n, Compactor& c) {
+        return { c.copy(n.expr), c.copy(n.times) };
+    }
+
+    Expr::Literal::Tup compact_node(const Expr::Literal::Tup& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.exprs) };
+    }
+
+    Expr::Literal::Struct compact_node(
+        const Expr::Literal::Struct& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.type), c.copy(n.fields) };
+    }
+
+    Expr::Literal::Struct::Field compact_node(
+        const Expr::Literal::Struct::Field& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name), c.copy(n.expr) };
+    }
+
+    Expr::Unop compact_node(const Expr::Unop& n, Compactor& c) {
+        return { c.copy(n.expr), c.copy(n.op) };
+    }
+
+    Expr::Binop compact_node(const Expr::Binop& n, Compactor& c) {
+        return { c.copy(n.lhs), c.copy(n.rhs), c.copy(n.op) };
+    }
+
+    Expr::Index compact_node(const Expr::Index& n, Compactor& c) {
+        return { c.copy(n.expr), c.copy(n.index) };
+    }
+
+    Expr::Call compact_node(const Expr::Call& n, Compactor& c) {
+        return { c.copy(n.expr), c.copy(n.args) };
+    }
+
+    Expr::Cast compact_node(const Expr::Cast& n, Compactor& c) {
+        return { c.copy(n.expr), c.copy(n.type) };
+    }
+
+    Expr::TryCast compact_node(const Expr::TryCast& n, Compactor& c) {
+        return { c.copy(n.expr), c.copy(n.type) };
+    }
+
+    Expr::Ref compact_node(const Expr::Ref& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.expr) };
+    }
+
+    Expr::Builtin compact_node(const Expr::Builtin& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name), c.copy(n.generic_params),
+            c.copy(n.args) };
+    }
+
+    Block compact_node(const Block& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.stmts) };
+    }
+
+    Stmt compact_node(const Stmt& n, Compactor& c) {
+        return { c.copy(n.val) };
+    }
+
+    Stmt::Let compact_node(const Stmt::Let& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name), c.copy(n.type),
+            c.copy(n.expr) };
+    }
+
+    Stmt::If compact_node(const Stmt::If& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.expr), c.copy(n.main),
+            c.copy(n.elifs), c.copy(n.else_) };
+    }
+
+    Stmt::If::Elif compact_node(const Stmt::If::Elif& n, Compactor& c) {
+        return { c.copy(n.expr), c.copy(n.block) };
+    }
+
+    Stmt::Switch compact_node(const Stmt::Switch& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.expr), c.copy(n.cases) };
+    }
+
+    Stmt::Switch::Case compact_node(const Stmt::Switch::Case& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.expr), c.copy(n.block) };
+    }
+
+    Stmt::Loop compact_node(const Stmt::Loop& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.block) };
+    }
+
+    Stmt::For compact_node(const Stmt::For& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name), c.copy(n.expr),
+            c.copy(n.block) };
+    }
+
+    Stmt::While compact_node(const Stmt::While& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.expr), c.copy(n.block) };
+    }
+
+    Stmt::Return compact_node(const Stmt::Return& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.expr) };
+    }
+
+    Stmt::Defer compact_node(const Stmt::Defer& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.expr) };
+    }
+
+    Stmt::Continue compact_node(
+        const Stmt::Continue& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Stmt::Break compact_node(
+        const Stmt::Break& n, [[maybe_unused]] Compactor& c) {
+        return n;
+    }
+
+    Func compact_node(const Func& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.signature), c.copy(n.block) };
+    }
+
+    Func::Signature compact_node(const Func::Signature& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.is_self_func), c.copy(n.params),
+            c.copy(n.ret) };
+    }
+
+    Func::Signature::Param compact_node(
+        const Func::Signature::Param& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name), c.copy(n.type) };
+    }
+
+    Decl compact_node(const Decl& n, Compactor& c) {
+        return { c.copy(n.is_export), c.copy(n.is_decls_block), c.copy(n.name),
+            c.copy(n.generic_params), c.copy(n.val) };
+    }
+
+    Decl::GenericParam compact_node(const Decl::GenericParam& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name), c.copy(n.interfaces) };
+    }
+
+    Decl::Struct compact_node(const Decl::Struct& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.fields) };
+    }
+
+    Decl::Struct::Field compact_node(
+        const Decl::Struct::Field& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name), c.copy(n.type),
+            c.copy(n.is_export) };
+    }
+
+    Decl::Enum compact_node(const Decl::Enum& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.elements) };
+    }
+
+    Decl::Enum::Element compact_node(
+        const Decl::Enum::Element& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name) };
+    }
+
+    Decl::TypeAlias compact_node(const Decl::TypeAlias& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.type) };
+    }
+
+    Decl::Const compact_node(const Decl::Const& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.type), c.copy(n.expr) };
+    }
+
+    Decl::Decls compact_node(const Decl::Decls& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.type), c.copy(n.interface),
+            c.copy(n.decls) };
+    }
+
+    Decl::Interface compact_node(const Decl::Interface& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.members) };
+    }
+
+    Decl::Interface::Member compact_node(
+        const Decl::Interface::Member& n, Compactor& c) {
+        return { c.copy(n.is_invalid), c.copy(n.name), c.copy(n.generic_params),
+            c.copy(n.signature) };
+    }
+
+    TopLevel compact_node(const TopLevel& n, Compactor& c) {
+        return { c.copy(n.val) };
+    }
+
+    Module compact_node(const Module& n, Compactor& c) {
+        return { c.copy(n.top_levels) };
+    }
+
 }
 
 namespace std {
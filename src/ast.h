@@ -11,8 +11,12 @@
 #include <string_view>
 #include <optional>
 #include <cstddef>
+#include <cstdint>
 
+#include "sym.h"
+#include "utf8.h"
 #include "ast/util.h"
+#include "ast/compact.h"
 #include "ast/print.h"
 
 namespace alvo::ast {
@@ -37,10 +41,10 @@ namespace alvo::ast {
         struct Super { };
 
         struct Name {
-            std::string_view value;
+            sym::Symbol value;
             util::List<Type> generic_params;
 
-            Name(const std::string_view& value,
+            Name(const sym::Symbol& value,
                 const util::List<Type>& generic_params) :
                 value(value),
                 generic_params(generic_params) { }
@@ -59,9 +63,9 @@ namespace alvo::ast {
         struct Glob { };
 
         struct Renamed {
-            std::string_view renamed_to;
+            sym::Symbol renamed_to;
 
-            Renamed(const std::string_view& renamed_to) :
+            Renamed(const sym::Symbol& renamed_to) :
                 renamed_to(renamed_to) { }
         };
 
@@ -162,37 +166,37 @@ namespace alvo::ast {
             };
 
             struct Character {
-                std::string_view value;
+                utf8::Codepoint value;
 
-                Character(const std::string_view& value) :
+                Character(const utf8::Codepoint& value) :
                     value(value) { }
             };
 
             struct Integer {
-                std::string_view value;
+                std::uint64_t value;
 
-                Integer(const std::string_view& value) :
+                Integer(const std::uint64_t& value) :
                     value(value) { }
             };
 
             struct Byte {
-                std::string_view value;
+                std::uint8_t value;
 
-                Byte(const std::string_view& value) :
+                Byte(const std::uint8_t& value) :
                     value(value) { }
             };
 
             struct Floating {
-                std::string_view value;
+                double value;
 
-                Floating(const std::string_view& value) :
+                Floating(const double& value) :
                     value(value) { }
             };
 
             struct Boolean {
-                std::string_view value;
+                bool value;
 
-                Boolean(const std::string_view& value) :
+                Boolean(const bool& value) :
                     value(value) { }
             };
 
@@ -241,10 +245,10 @@ namespace alvo::ast {
             struct Struct {
                 struct Field {
                     bool is_invalid;
-                    std::string_view name;
+                    sym::Symbol name;
                     util::Ptr<Expr> expr;
 
-                    Field(const bool& is_invalid, const std::string_view& name,
+                    Field(const bool& is_invalid, const sym::Symbol& name,
                         const util::Ptr<Expr>& expr) :
                         is_invalid(is_invalid),
                         name(name),
@@ -380,11 +384,11 @@ namespace alvo::ast {
 
         struct Builtin {
             bool is_invalid;
-            std::string_view name;
+            sym::Symbol name;
             util::List<Type> generic_params;
             util::List<Expr> args;
 
-            Builtin(const bool& is_invalid, const std::string_view& name,
+            Builtin(const bool& is_invalid, const sym::Symbol& name,
                 const util::List<Type>& generic_params,
                 const util::List<Expr>& args) :
                 is_invalid(is_invalid),
@@ -413,11 +417,11 @@ namespace alvo::ast {
     struct Stmt {
         struct Let {
             bool is_invalid;
-            std::string_view name;
+            sym::Symbol name;
             std::optional<Type> type;
             std::optional<Expr> expr;
 
-            Let(const bool& is_invalid, const std::string_view& name,
+            Let(const bool& is_invalid, const sym::Symbol& name,
                 const std::optional<Type>& type,
                 const std::optional<Expr>& expr) :
                 is_invalid(is_invalid),
@@ -487,11 +491,11 @@ namespace alvo::ast {
 
         struct For {
             bool is_invalid;
-            std::string_view name;
+            sym::Symbol name;
             Expr expr;
             Block block;
 
-            For(const bool& is_invalid, const std::string_view& name,
+            For(const bool& is_invalid, const sym::Symbol& name,
                 const Expr& expr, const Block& block) :
                 is_invalid(is_invalid),
                 name(name),
@@ -545,10 +549,10 @@ namespace alvo::ast {
         struct Signature {
             struct Param {
                 bool is_invalid;
-                std::string_view name;
+                sym::Symbol name;
                 Type type;
 
-                Param(const bool& is_invalid, const std::string_view& name,
+                Param(const bool& is_invalid, const sym::Symbol& name,
                     const Type& type) :
                     is_invalid(is_invalid),
                     name(name),
@@ -582,10 +586,10 @@ namespace alvo::ast {
     struct Decl {
         struct GenericParam {
             bool is_invalid;
-            std::string_view name;
+            sym::Symbol name;
             util::List<Type> interfaces;
 
-            GenericParam(const bool& is_invalid, const std::string_view& name,
+            GenericParam(const bool& is_invalid, const sym::Symbol& name,
                 const util::List<Type>& interfaces) :
                 is_invalid(is_invalid),
                 name(name),
@@ -595,11 +599,11 @@ namespace alvo::ast {
         struct Struct {
             struct Field {
                 bool is_invalid;
-                std::string_view name;
+                sym::Symbol name;
                 Type type;
                 bool is_export;
 
-                Field(const bool& is_invalid, const std::string_view& name,
+                Field(const bool& is_invalid, const sym::Symbol& name,
                     const Type& type, const bool& is_export) :
                     is_invalid(is_invalid),
                     name(name),
@@ -618,9 +622,9 @@ namespace alvo::ast {
         struct Enum {
             struct Element {
                 bool is_invalid;
-                std::string_view name;
+                sym::Symbol name;
 
-                Element(const bool& is_invalid, const std::string_view& name) :
+                Element(const bool& is_invalid, const sym::Symbol& name) :
                     is_invalid(is_invalid),
                     name(name) { }
             };
@@ -671,11 +675,11 @@ namespace alvo::ast {
         struct Interface {
             struct Member {
                 bool is_invalid;
-                std::string_view name;
+                sym::Symbol name;
                 util::List<GenericParam> generic_params;
                 Func::Signature signature;
 
-                Member(const bool& is_invalid, const std::string_view& name,
+                Member(const bool& is_invalid, const sym::Symbol& name,
                     const util::List<GenericParam>& generic_params,
                     const Func::Signature& signature) :
                     is_invalid(is_invalid),
@@ -697,12 +701,12 @@ namespace alvo::ast {
             Decls, Interface>;
         bool is_export;
         bool is_decls_block;
-        std::string_view name;
+        sym::Symbol name;
         util::List<GenericParam> generic_params;
         Val val;
 
         Decl(const bool& is_export, const bool& is_decls_block,
-            const std::string_view& name,
+            const sym::Symbol& name,
             const util::List<GenericParam>& generic_params, const Val& val) :
             is_export(is_export),
             is_decls_block(is_decls_block),
@@ -939,6 +943,110 @@ namespace alvo::ast {
     bool operator!=(const TopLevel& l, const TopLevel& r);
     bool operator!=(const Module& l, const Module& r);
 
+    Invalid compact_node(const Invalid& n, [[maybe_unused]] Compactor& c);
+    PathSegment compact_node(const PathSegment& n, Compactor& c);
+    PathSegment::Root compact_node(
+        const PathSegment::Root& n, [[maybe_unused]] Compactor& c);
+    PathSegment::Super compact_node(
+        const PathSegment::Super& n, [[maybe_unused]] Compactor& c);
+    PathSegment::Name compact_node(const PathSegment::Name& n, Compactor& c);
+    Import compact_node(const Import& n, Compactor& c);
+    Import::Normal compact_node(
+        const Import::Normal& n, [[maybe_unused]] Compactor& c);
+    Import::Glob compact_node(
+        const Import::Glob& n, [[maybe_unused]] Compactor& c);
+    Import::Renamed compact_node(const Import::Renamed& n, Compactor& c);
+    Type compact_node(const Type& n, Compactor& c);
+    Type::Unit compact_node(const Type::Unit& n, [[maybe_unused]] Compactor& c);
+    Type::String compact_node(
+        const Type::String& n, [[maybe_unused]] Compactor& c);
+    Type::Char compact_node(const Type::Char& n, [[maybe_unused]] Compactor& c);
+    Type::Int compact_node(const Type::Int& n, [[maybe_unused]] Compactor& c);
+    Type::Byte compact_node(const Type::Byte& n, [[maybe_unused]] Compactor& c);
+    Type::Float compact_node(
+        const Type::Float& n, [[maybe_unused]] Compactor& c);
+    Type::Bool compact_node(const Type::Bool& n, [[maybe_unused]] Compactor& c);
+    Type::Array compact_node(const Type::Array& n, Compactor& c);
+    Type::Tup compact_node(const Type::Tup& n, Compactor& c);
+    Type::Func compact_node(const Type::Func& n, Compactor& c);
+    Type::Path compact_node(const Type::Path& n, Compactor& c);
+    Type::Ref compact_node(const Type::Ref& n, Compactor& c);
+    Expr compact_node(const Expr& n, Compactor& c);
+    Expr::Literal compact_node(const Expr::Literal& n, Compactor& c);
+    Expr::Literal::Unit compact_node(
+        const Expr::Literal::Unit& n, [[maybe_unused]] Compactor& c);
+    Expr::Literal::Null compact_node(
+        const Expr::Literal::Null& n, [[maybe_unused]] Compactor& c);
+    Expr::Literal::String compact_node(
+        const Expr::Literal::String& n, Compactor& c);
+    Expr::Literal::Character compact_node(
+        const Expr::Literal::Character& n, Compactor& c);
+    Expr::Literal::Integer compact_node(
+        const Expr::Literal::Integer& n, Compactor& c);
+    Expr::Literal::Byte compact_node(
+        const Expr::Literal::Byte& n, Compactor& c);
+    Expr::Literal::Floating compact_node(
+        const Expr::Literal::Floating& n, Compactor& c);
+    Expr::Literal::Boolean compact_node(
+        const Expr::Literal::Boolean& n, Compactor& c);
+    Expr::Literal::Array compact_node(
+        const Expr::Literal::Array& n, Compactor& c);
+    Expr::Literal::Array::Regular compact_node(
+        const Expr::Literal::Array::Regular& n, Compactor& c);
+    Expr::Literal::Array::DefaultNTimes compact_node(
+        const Expr::Literal::Array::DefaultNTimes& n, Compactor& c);
+    Expr::Literal::Array::ExprNTimes compact_node(
+        const Expr::Literal::Array::ExprNTimes& n, Compactor& c);
+    Expr::Literal::Tup compact_node(const Expr::Literal::Tup& n, Compactor& c);
+    Expr::Literal::Struct compact_node(
+        const Expr::Literal::Struct& n, Compactor& c);
+    Expr::Literal::Struct::Field compact_node(
+        const Expr::Literal::Struct::Field& n, Compactor& c);
+    Expr::Unop compact_node(const Expr::Unop& n, Compactor& c);
+    Expr::Binop compact_node(const Expr::Binop& n, Compactor& c);
+    Expr::Index compact_node(const Expr::Index& n, Compactor& c);
+    Expr::Call compact_node(const Expr::Call& n, Compactor& c);
+    Expr::Cast compact_node(const Expr::Cast& n, Compactor& c);
+    Expr::TryCast compact_node(const Expr::TryCast& n, Compactor& c);
+    Expr::Ref compact_node(const Expr::Ref& n, Compactor& c);
+    Expr::Builtin compact_node(const Expr::Builtin& n, Compactor& c);
+    Block compact_node(const Block& n, Compactor& c);
+    Stmt compact_node(const Stmt& n, Compactor& c);
+    Stmt::Let compact_node(const Stmt::Let& n, Compactor& c);
+    Stmt::If compact_node(const Stmt::If& n, Compactor& c);
+    Stmt::If::Elif compact_node(const Stmt::If::Elif& n, Compactor& c);
+    Stmt::Switch compact_node(const Stmt::Switch& n, Compactor& c);
+    Stmt::Switch::Case compact_node(const Stmt::Switch::Case& n, Compactor& c);
+    Stmt::Loop compact_node(const Stmt::Loop& n, Compactor& c);
+    Stmt::For compact_node(const Stmt::For& n, Compactor& c);
+    Stmt::While compact_node(const Stmt::While& n, Compactor& c);
+    Stmt::Return compact_node(const Stmt::Return& n, Compactor& c);
+    Stmt::Defer compact_node(const Stmt::Defer& n, Compactor& c);
+    Stmt::Continue compact_node(
+        const Stmt::Continue& n, [[maybe_unused]] Compactor& c);
+    Stmt::Break compact_node(
+        const Stmt::Break& n, [[maybe_unused]] Compactor& c);
+    Func compact_node(const Func& n, Compactor& c);
+    Func::Signature compact_node(const Func::Signature& n, Compactor& c);
+    Func::Signature::Param compact_node(
+        const Func::Signature::Param& n, Compactor& c);
+    Decl compact_node(const Decl& n, Compactor& c);
+    Decl::GenericParam compact_node(const Decl::GenericParam& n, Compactor& c);
+    Decl::Struct compact_node(const Decl::Struct& n, Compactor& c);
+    Decl::Struct::Field compact_node(
+        const Decl::Struct::Field& n, Compactor& c);
+    Decl::Enum compact_node(const Decl::Enum& n, Compactor& c);
+    Decl::Enum::Element compact_node(
+        const Decl::Enum::Element& n, Compactor& c);
+    Decl::TypeAlias compact_node(const Decl::TypeAlias& n, Compactor& c);
+    Decl::Const compact_node(const Decl::Const& n, Compactor& c);
+    Decl::Decls compact_node(const Decl::Decls& n, Compactor& c);
+    Decl::Interface compact_node(const Decl::Interface& n, Compactor& c);
+    Decl::Interface::Member compact_node(
+        const Decl::Interface::Member& n, Compactor& c);
+    TopLevel compact_node(const TopLevel& n, Compactor& c);
+    Module compact_node(const Module& n, Compactor& c);
+
     template<print::PrinterSink Sink>
     class Printer : public print::PrinterBase<Sink, Printer<Sink>> {
     private:
@@ -2182,3 +2290,474 @@ namespace std {
     };
 
 }
+
+namespace alvo::ast::util {
+
+    template<>
+    struct NodeKind<Invalid> {
+        static constexpr std::size_t index = 0;
+    };
+
+    template<>
+    struct NodeKind<PathSegment> {
+        static constexpr std::size_t index = 1;
+    };
+
+    template<>
+    struct NodeKind<PathSegment::Root> {
+        static constexpr std::size_t index = 2;
+    };
+
+    template<>
+    struct NodeKind<PathSegment::Super> {
+        static constexpr std::size_t index = 3;
+    };
+
+    template<>
+    struct NodeKind<PathSegment::Name> {
+        static constexpr std::size_t index = 4;
+    };
+
+    template<>
+    struct NodeKind<Import> {
+        static constexpr std::size_t index = 5;
+    };
+
+    template<>
+    struct NodeKind<Import::Normal> {
+        static constexpr std::size_t index = 6;
+    };
+
+    template<>
+    struct NodeKind<Import::Glob> {
+        static constexpr std::size_t index = 7;
+    };
+
+    template<>
+    struct NodeKind<Import::Renamed> {
+        static constexpr std::size_t index = 8;
+    };
+
+    template<>
+    struct NodeKind<Type> {
+        static constexpr std::size_t index = 9;
+    };
+
+    template<>
+    struct NodeKind<Type::Unit> {
+        static constexpr std::size_t index = 10;
+    };
+
+    template<>
+    struct NodeKind<Type::String> {
+        static constexpr std::size_t index = 11;
+    };
+
+    template<>
+    struct NodeKind<Type::Char> {
+        static constexpr std::size_t index = 12;
+    };
+
+    template<>
+    struct NodeKind<Type::Int> {
+        static constexpr std::size_t index = 13;
+    };
+
+    template<>
+    struct NodeKind<Type::Byte> {
+        static constexpr std::size_t index = 14;
+    };
+
+    template<>
+    struct NodeKind<Type::Float> {
+        static constexpr std::size_t index = 15;
+    };
+
+    template<>
+    struct NodeKind<Type::Bool> {
+        static constexpr std::size_t index = 16;
+    };
+
+    template<>
+    struct NodeKind<Type::Array> {
+        static constexpr std::size_t index = 17;
+    };
+
+    template<>
+    struct NodeKind<Type::Tup> {
+        static constexpr std::size_t index = 18;
+    };
+
+    template<>
+    struct NodeKind<Type::Func> {
+        static constexpr std::size_t index = 19;
+    };
+
+    template<>
+    struct NodeKind<Type::Path> {
+        static constexpr std::size_t index = 20;
+    };
+
+    template<>
+    struct NodeKind<Type::Ref> {
+        static constexpr std::size_t index = 21;
+    };
+
+    template<>
+    struct NodeKind<Expr> {
+        static constexpr std::size_t index = 22;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal> {
+        static constexpr std::size_t index = 23;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Unit> {
+        static constexpr std::size_t index = 24;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Null> {
+        static constexpr std::size_t index = 25;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::String> {
+        static constexpr std::size_t index = 26;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Character> {
+        static constexpr std::size_t index = 27;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Integer> {
+        static constexpr std::size_t index = 28;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Byte> {
+        static constexpr std::size_t index = 29;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Floating> {
+        static constexpr std::size_t index = 30;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Boolean> {
+        static constexpr std::size_t index = 31;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Array> {
+        static constexpr std::size_t index = 32;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Array::Regular> {
+        static constexpr std::size_t index = 33;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Array::DefaultNTimes> {
+        static constexpr std::size_t index = 34;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Array::ExprNTimes> {
+        static constexpr std::size_t index = 35;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Tup> {
+        static constexpr std::size_t index = 36;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Struct> {
+        static constexpr std::size_t index = 37;
+    };
+
+    template<>
+    struct NodeKind<Expr::Literal::Struct::Field> {
+        static constexpr std::size_t index = 38;
+    };
+
+    template<>
+    struct NodeKind<Expr::Unop> {
+        static constexpr std::size_t index = 39;
+    };
+
+    template<>
+    struct NodeKind<Expr::Binop> {
+        static constexpr std::size_t index = 40;
+    };
+
+    template<>
+    struct NodeKind<Expr::Index> {
+        static constexpr std::size_t index = 41;
+    };
+
+    template<>
+    struct NodeKind<Expr::Call> {
+        static constexpr std::size_t index = 42;
+    };
+
+    template<>
+    struct NodeKind<Expr::Cast> {
+        static constexpr std::size_t index = 43;
+    };
+
+    template<>
+    struct NodeKind<Expr::TryCast> {
+        static constexpr std::size_t index = 44;
+    };
+
+    template<>
+    struct NodeKind<Expr::Ref> {
+        static constexpr std::size_t index = 45;
+    };
+
+    template<>
+    struct NodeKind<Expr::Builtin> {
+        static constexpr std::size_t index = 46;
+    };
+
+    template<>
+    struct NodeKind<Block> {
+        static constexpr std::size_t index = 47;
+    };
+
+    template<>
+    struct NodeKind<Stmt> {
+        static constexpr std::size_t index = 48;
+    };
+
+    template<>
+    struct NodeKind<Stmt::Let> {
+        static constexpr std::size_t index = 49;
+    };
+
+    template<>
+    struct NodeKind<Stmt::If> {
+        static constexpr std::size_t index = 50;
+    };
+
+    template<>
+    struct NodeKind<Stmt::If::Elif> {
+        static constexpr std::size_t index = 51;
+    };
+
+    template<>
+    struct NodeKind<Stmt::Switch> {
+        static constexpr std::size_t index = 52;
+    };
+
+    template<>
+    struct NodeKind<Stmt::Switch::Case> {
+        static constexpr std::size_t index = 53;
+    };
+
+    template<>
+    struct NodeKind<Stmt::Loop> {
+        static constexpr std::size_t index = 54;
+    };
+
+    template<>
+    struct NodeKind<Stmt::For> {
+        static constexpr std::size_t index = 55;
+    };
+
+    template<>
+    struct NodeKind<Stmt::While> {
+        static constexpr std::size_t index = 56;
+    };
+
+    template<>
+    struct NodeKind<Stmt::Return> {
+        static constexpr std::size_t index = 57;
+    };
+
+    template<>
+    struct NodeKind<Stmt::Defer> {
+        static constexpr std::size_t index = 58;
+    };
+
+    template<>
+    struct NodeKind<Stmt::Continue> {
+        static constexpr std::size_t index = 59;
+    };
+
+    template<>
+    struct NodeKind<Stmt::Break> {
+        static constexpr std::size_t index = 60;
+    };
+
+    template<>
+    struct NodeKind<Func> {
+        static constexpr std::size_t index = 61;
+    };
+
+    template<>
+    struct NodeKind<Func::Signature> {
+        static constexpr std::size_t index = 62;
+    };
+
+    template<>
+    struct NodeKind<Func::Signature::Param> {
+        static constexpr std::size_t index = 63;
+    };
+
+    template<>
+    struct NodeKind<Decl> {
+        static constexpr std::size_t index = 64;
+    };
+
+    template<>
+    struct NodeKind<Decl::GenericParam> {
+        static constexpr std::size_t index = 65;
+    };
+
+    template<>
+    struct NodeKind<Decl::Struct> {
+        static constexpr std::size_t index = 66;
+    };
+
+    template<>
+    struct NodeKind<Decl::Struct::Field> {
+        static constexpr std::size_t index = 67;
+    };
+
+    template<>
+    struct NodeKind<Decl::Enum> {
+        static constexpr std::size_t index = 68;
+    };
+
+    template<>
+    struct NodeKind<Decl::Enum::Element> {
+        static constexpr std::size_t index = 69;
+    };
+
+    template<>
+    struct NodeKind<Decl::TypeAlias> {
+        static constexpr std::size_t index = 70;
+    };
+
+    template<>
+    struct NodeKind<Decl::Const> {
+        static constexpr std::size_t index = 71;
+    };
+
+    template<>
+    struct NodeKind<Decl::Decls> {
+        static constexpr std::size_t index = 72;
+    };
+
+    template<>
+    struct NodeKind<Decl::Interface> {
+        static constexpr std::size_t index = 73;
+    };
+
+    template<>
+    struct NodeKind<Decl::Interface::Member> {
+        static constexpr std::size_t index = 74;
+    };
+
+    template<>
+    struct NodeKind<TopLevel> {
+        static constexpr std::size_t index = 75;
+    };
+
+    template<>
+    struct NodeKind<Module> {
+        static constexpr std::size_t index = 76;
+    };
+
+    inline constexpr std::size_t NODE_KIND_COUNT = 77;
+
+    inline constexpr std::string_view NODE_KIND_NAMES[] = {
+        "Invalid",
+        "PathSegment",
+        "PathSegment::Root",
+        "PathSegment::Super",
+        "PathSegment::Name",
+        "Import",
+        "Import::Normal",
+        "Import::Glob",
+        "Import::Renamed",
+        "Type",
+        "Type::Unit",
+        "Type::String",
+        "Type::Char",
+        "Type::Int",
+        "Type::Byte",
+        "Type::Float",
+        "Type::Bool",
+        "Type::Array",
+        "Type::Tup",
+        "Type::Func",
+        "Type::Path",
+        "Type::Ref",
+        "Expr",
+        "Expr::Literal",
+        "Expr::Literal::Unit",
+        "Expr::Literal::Null",
+        "Expr::Literal::String",
+        "Expr::Literal::Character",
+        "Expr::Literal::Integer",
+        "Expr::Literal::Byte",
+        "Expr::Literal::Floating",
+        "Expr::Literal::Boolean",
+        "Expr::Literal::Array",
+        "Expr::Literal::Array::Regular",
+        "Expr::Literal::Array::DefaultNTimes",
+        "Expr::Literal::Array::ExprNTimes",
+        "Expr::Literal::Tup",
+        "Expr::Literal::Struct",
+        "Expr::Literal::Struct::Field",
+        "Expr::Unop",
+        "Expr::Binop",
+        "Expr::Index",
+        "Expr::Call",
+        "Expr::Cast",
+        "Expr::TryCast",
+        "Expr::Ref",
+        "Expr::Builtin",
+        "Block",
+        "Stmt",
+        "Stmt::Let",
+        "Stmt::If",
+        "Stmt::If::Elif",
+        "Stmt::Switch",
+        "Stmt::Switch::Case",
+        "Stmt::Loop",
+        "Stmt::For",
+        "Stmt::While",
+        "Stmt::Return",
+        "Stmt::Defer",
+        "Stmt::Continue",
+        "Stmt::Break",
+        "Func",
+        "Func::Signature",
+        "Func::Signature::Param",
+        "Decl",
+        "Decl::GenericParam",
+        "Decl::Struct",
+        "Decl::Struct::Field",
+        "Decl::Enum",
+        "Decl::Enum::Element",
+        "Decl::TypeAlias",
+        "Decl::Const",
+        "Decl::Decls",
+        "Decl::Interface",
+        "Decl::Interface::Member",
+        "TopLevel",
+        "Module",
+    };
+
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <variant>
+
+#include "util.h"
+#include "../mem.h"
+
+namespace alvo::ast {
+
+    class Compactor;
+
+    // Satisfied by the node types of the generated `ast.h`, which provide a
+    // `compact_node()` overload copying their fields through a `Compactor`
+    template<typename T>
+    concept CompactNode = requires(const T& node, Compactor& compactor) {
+        { compact_node(node, compactor) } -> std::same_as<T>;
+    };
+
+    // Whether `T` points into the arena of the tree, such fields must be
+    // copied by their own `Compactor::copy()` overload
+    template<typename T>
+    inline constexpr bool _is_arena_backed = false;
+
+    template<typename T>
+    inline constexpr bool _is_arena_backed<util::Ptr<T>> = true;
+
+    template<typename T>
+    inline constexpr bool _is_arena_backed<util::List<T>> = true;
+
+    template<typename T>
+    inline constexpr bool _is_arena_backed<util::Array<T>> = true;
+
+    // Deep-copies a tree into another arena in depth-first order: every node
+    // is placed before its children and the elements of each `List` and
+    // `Array` are placed back to back, ahead of the subtrees of their values
+    class Compactor {
+    public:
+        Compactor(mem::Arena& dst) :
+            m_dst(&dst) { }
+
+        template<typename T>
+        T copy(const T& val) {
+            if constexpr (CompactNode<T>) {
+                return compact_node(val, *this);
+            } else {
+                static_assert(
+                    std::is_trivially_copyable_v<T> && !_is_arena_backed<T>,
+                    "Leaf fields are copied as is and must not own memory");
+                return val;
+            }
+        }
+
+        template<typename T>
+        util::Ptr<T> copy(const util::Ptr<T>& ptr) {
+            if (ptr.get_ptr() == nullptr) {
+                return util::Ptr<T>::null();
+            }
+            // Reserve the slot first, so that the node precedes its
+            // children, and register its destructor once it is built
+            void* mem = m_dst->alloc(sizeof(T), alignof(T));
+            T* node = new (mem) T(copy(*ptr));
+            m_dst->own(node);
+            return util::Ptr<T>(node);
+        }
+
+        template<typename T>
+        util::List<T> copy(const util::List<T>& list) {
+            return list.copy_contiguous(
+                *m_dst, [this](const T& val) { return copy(val); });
+        }
+
+        template<typename T>
+        util::Array<T> copy(const util::Array<T>& array) {
+            if (array.empty()) {
+                return util::Array<T>();
+            }
+            T* data = static_cast<T*>(
+                m_dst->alloc(sizeof(T) * array.size(), alignof(T)));
+            for (std::size_t i = 0; i < array.size(); i++) {
+                new (data + i) T(copy(array[i]));
+                m_dst->own(data + i);
+            }
+            return util::Array<T>(data, array.size());
+        }
+
+        template<typename... Ts>
+        std::variant<Ts...> copy(const std::variant<Ts...>& val) {
+            return std::visit(
+                [this](const auto& alt) -> std::variant<Ts...> {
+                    return copy(alt);
+                },
+                val);
+        }
+
+        template<typename T>
+        std::optional<T> copy(const std::optional<T>& val) {
+            if (!val) {
+                return std::nullopt;
+            }
+            return copy(*val);
+        }
+
+    private:
+        mem::Arena* m_dst;
+    };
+
+    // Returns a copy of the tree rooted at `node` laid out in `dst` by a
+    // `Compactor`. The source arena can be reset afterwards.
+    template<typename T>
+    T compact(const T& node, mem::Arena& dst) {
+        Compactor compactor(dst);
+        return compactor.copy(node);
+    }
+
+}
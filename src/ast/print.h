@@ -1,5 +1,6 @@
 #pragma once
 
+#include <charconv>
 #include <iterator>
 #include <cstddef>
 #include <string_view>
@@ -7,8 +8,11 @@
 #include <ostream>
 #include <cstdint>
 #include <optional>
+#include <type_traits>
 
 #include "util.h"
+#include "../sym.h"
+#include "../utf8.h"
 
 namespace alvo::ast::print {
 
@@ -120,6 +124,7 @@ namespace alvo::ast::print {
         Style field_name;
         Style string;
         Style boolean;
+        Style number;
     };
 
     template<PrinterSink Sink, typename Derived>
@@ -207,6 +212,52 @@ namespace alvo::ast::print {
 
         void reset_style() { m_sink->write("\x1b[0m"); }
 
+        // Writes decoded literal text with the escapes the lexer decodes put
+        // back, other control characters as `\xHH`
+        void write_escaped(std::string_view value) {
+            std::size_t run_begin = 0;
+            for (std::size_t i = 0; i < value.size(); i++) {
+                unsigned char ch = (unsigned char)value[i];
+                std::string_view escape;
+                char hex[4] = { '\\', 'x', 0, 0 };
+                switch (ch) {
+                case '\n':
+                    escape = "\\n";
+                    break;
+                case '\r':
+                    escape = "\\r";
+                    break;
+                case '\t':
+                    escape = "\\t";
+                    break;
+                case '\0':
+                    escape = "\\0";
+                    break;
+                case '\\':
+                    escape = "\\\\";
+                    break;
+                case '\'':
+                    escape = "\\'";
+                    break;
+                case '"':
+                    escape = "\\\"";
+                    break;
+                default:
+                    if (ch >= 0x20 && ch != 0x7F) {
+                        continue;
+                    }
+                    hex[2] = "0123456789ABCDEF"[ch >> 4];
+                    hex[3] = "0123456789ABCDEF"[ch & 0xF];
+                    escape = std::string_view(hex, sizeof(hex));
+                    break;
+                }
+                m_sink->write(value.substr(run_begin, i - run_begin));
+                m_sink->write(escape);
+                run_begin = i + 1;
+            }
+            m_sink->write(value.substr(run_begin));
+        }
+
         void set_style_node_name() {
             if (m_style_config) {
                 set_style(m_style_config->node_name);
@@ -231,6 +282,12 @@ namespace alvo::ast::print {
             }
         }
 
+        void set_style_number() {
+            if (m_style_config) {
+                set_style(m_style_config->number);
+            }
+        }
+
         void indent() {
             for (std::size_t i = 0; i < m_indent * m_indent_width; i++) {
                 m_sink->write(" ");
@@ -332,12 +389,36 @@ namespace alvo::ast::print {
             field_name(name);
             set_style_string();
             m_sink->write("`");
-            m_sink->write(value);
+            write_escaped(value);
             m_sink->write("`");
             reset_style();
             m_sink->write("\n");
         }
 
+        void field(std::string_view name, sym::Symbol value) {
+            field(name, value.str());
+        }
+
+        template<typename T>
+            requires std::is_arithmetic_v<T> && (!std::is_same_v<T, bool>) &&
+                     (!std::is_same_v<T, utf8::Codepoint>)
+        void field(std::string_view name, const T& value) {
+            // Wide enough for the shortest round trip form of any double
+            char buf[32];
+            std::to_chars_result res =
+                std::to_chars(buf, buf + sizeof(buf), value);
+            field_name(name);
+            set_style_number();
+            m_sink->write(std::string_view(buf, res.ptr - buf));
+            reset_style();
+            m_sink->write("\n");
+        }
+
+        void field(std::string_view name, utf8::Codepoint value) {
+            char buf[4];
+            field(name, std::string_view(buf, utf8::encode(value, buf)));
+        }
+
         Sink* m_sink;
         std::size_t m_indent;
         std::size_t m_indent_width;
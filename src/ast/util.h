@@ -3,6 +3,12 @@
 #include <iterator>
 #include <concepts>
 #include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "../mem.h"
 
@@ -44,6 +50,183 @@ namespace alvo::ast::util {
         T* m_ptr;
     };
 
+    // Specialized for every node type in the generated `ast.h`, provides
+    // `index` into `NODE_KIND_NAMES`
+    template<typename T>
+    struct NodeKind;
+
+    struct AllocStat {
+        std::size_t count;
+        std::size_t bytes;
+    };
+
+    // Allocation counters per node kind, for nodes made through `NodeCtx`
+    // and for the nodes of `List`s holding each kind
+    class AllocStats {
+    public:
+        // Checkpoint of the counters, see `mark()` and `rewind()`
+        struct Mark {
+            std::size_t log_size;
+        };
+
+        AllocStats() :
+            m_nodes(),
+            m_list_nodes(),
+            m_total(),
+            m_log(),
+            m_mark_depth(0) { }
+
+        void record_node(std::size_t kind, std::size_t bytes) {
+            record(m_nodes, kind, bytes);
+            if (m_mark_depth > 0) {
+                m_log.push_back(LogEntry { kind, bytes, false });
+            }
+        }
+
+        void record_list_node(std::size_t kind, std::size_t bytes) {
+            record(m_list_nodes, kind, bytes);
+            if (m_mark_depth > 0) {
+                m_log.push_back(LogEntry { kind, bytes, true });
+            }
+        }
+
+        // Every mark must be given back to `release()`
+        Mark mark() {
+            m_mark_depth++;
+            return Mark { m_log.size() };
+        }
+
+        // Once no mark is left nothing can be rewound, so the log is dropped
+        void release() {
+            m_mark_depth--;
+            if (m_mark_depth == 0) {
+                m_log.clear();
+            }
+        }
+
+        // Takes back every allocation recorded since `mark`, to follow an
+        // arena rewound to the same point
+        void rewind(Mark mark) {
+            while (m_log.size() > mark.log_size) {
+                const LogEntry& entry = m_log.back();
+                AllocStat& stat = entry.list ? m_list_nodes[entry.kind]
+                                             : m_nodes[entry.kind];
+                stat.count--;
+                stat.bytes -= entry.bytes;
+                m_total.count--;
+                m_total.bytes -= entry.bytes;
+                m_log.pop_back();
+            }
+        }
+
+        const std::vector<AllocStat>& get_nodes() const { return m_nodes; }
+
+        const std::vector<AllocStat>& get_list_nodes() const {
+            return m_list_nodes;
+        }
+
+        AllocStat get_total() const { return m_total; }
+
+    private:
+        void record(std::vector<AllocStat>& stats, std::size_t kind,
+            std::size_t bytes) {
+            if (kind >= stats.size()) {
+                stats.resize(kind + 1, AllocStat { 0, 0 });
+            }
+            stats[kind].count++;
+            stats[kind].bytes += bytes;
+            m_total.count++;
+            m_total.bytes += bytes;
+        }
+
+        struct LogEntry {
+            std::size_t kind;
+            std::size_t bytes;
+            bool list;
+        };
+
+        std::vector<AllocStat> m_nodes;
+        std::vector<AllocStat> m_list_nodes;
+        AllocStat m_total;
+        // Allocations recorded while a mark is live, in order, so that
+        // `rewind()` can take back the most recent ones
+        std::vector<LogEntry> m_log;
+        std::size_t m_mark_depth;
+    };
+
+    class NodeCtx {
+    public:
+        // Checkpoint of the arena and of the allocation counters, live
+        // until it goes out of scope
+        class Mark {
+        public:
+            Mark(const Mark&) = delete;
+
+            Mark(Mark&&) = delete;
+
+            Mark& operator=(const Mark&) = delete;
+
+            Mark& operator=(Mark&&) = delete;
+
+            ~Mark() {
+                if (m_stats) {
+                    m_stats->release();
+                }
+            }
+
+        private:
+            Mark(mem::Arena& arena, AllocStats* stats) :
+                m_arena_mark(arena.mark()),
+                m_stats(stats),
+                m_stats_mark(
+                    stats ? stats->mark() : AllocStats::Mark { 0 }) { }
+
+            mem::Arena::Mark m_arena_mark;
+            AllocStats* m_stats;
+            AllocStats::Mark m_stats_mark;
+
+            friend class NodeCtx;
+        };
+
+        NodeCtx(mem::Arena& arena) :
+            m_arena(&arena),
+            m_stats(nullptr) { }
+
+        void set_alloc_stats(AllocStats& stats) { m_stats = &stats; }
+
+        Mark mark() const { return Mark(*m_arena, m_stats); }
+
+        // Rewinds the arena to `mark` and drops the released nodes from the
+        // allocation counters
+        void rewind(const Mark& mark) {
+            m_arena->rewind(mark.m_arena_mark);
+            if (mark.m_stats) {
+                mark.m_stats->rewind(mark.m_stats_mark);
+            }
+        }
+
+        template<typename T, typename... Args>
+        Ptr<T> make_node(Args&&... args) {
+            if (m_stats) {
+                m_stats->record_node(NodeKind<T>::index, sizeof(T));
+            }
+            return Ptr<T>(m_arena->make<T>(std::forward<Args>(args)...));
+        }
+
+        // Makes a list node of type `N` holding values of type `T`
+        template<typename T, typename N>
+        N* make_list_node(N&& node) {
+            if (m_stats) {
+                m_stats->record_list_node(NodeKind<T>::index, sizeof(N));
+            }
+            return m_arena->make<N>(std::move(node));
+        }
+
+    private:
+        mem::Arena* m_arena;
+        AllocStats* m_stats;
+    };
+
     template<typename T>
     class Array {
     public:
@@ -230,9 +413,8 @@ namespace alvo::ast::util {
             m_tail(nullptr),
             m_size(0) { }
 
-        void push_back(mem::Arena& arena, const T& val) {
-            void* mem = arena.alloc(sizeof(Node), alignof(Node));
-            Node* node = new (mem) Node { val, nullptr };
+        void push_back(NodeCtx& ctx, const T& val) {
+            Node* node = ctx.make_list_node<T>(Node { val, nullptr });
             if (m_tail) {
                 m_tail->next = node;
             } else {
@@ -242,9 +424,9 @@ namespace alvo::ast::util {
             m_size++;
         }
 
-        void push_back(mem::Arena& arena, T&& val) {
-            void* mem = arena.alloc(sizeof(Node), alignof(Node));
-            Node* node = new (mem) Node { std::move(val), nullptr };
+        void push_back(NodeCtx& ctx, T&& val) {
+            Node* node =
+                ctx.make_list_node<T>(Node { std::move(val), nullptr });
             if (m_tail) {
                 m_tail->next = node;
             } else {
@@ -258,15 +440,28 @@ namespace alvo::ast::util {
 
         bool empty() const { return m_size == 0; }
 
-        Array<T> flatten(mem::Arena& arena) {
-            T* mem =
-                static_cast<T*>(arena.alloc(sizeof(T) * m_size, alignof(T)));
-            std::size_t offset = 0;
-            for (T& v : *this) {
-                new (mem + offset) T(std::move(v));
-                offset++;
+        // Copies the list into `arena` with all of its nodes placed back to
+        // back, so that iterating the copy walks memory linearly. Values are
+        // mapped through `copy` in order, after the nodes are allocated.
+        template<typename F>
+        List<T> copy_contiguous(mem::Arena& arena, F&& copy) const {
+            static_assert(std::is_trivially_destructible_v<Node>);
+            List<T> res;
+            if (m_size == 0) {
+                return res;
             }
-            return Array<T>(mem, m_size);
+            Node* nodes = static_cast<Node*>(
+                arena.alloc(sizeof(Node) * m_size, alignof(Node)));
+            std::size_t i = 0;
+            for (const T& val : *this) {
+                Node* next = i + 1 < m_size ? nodes + i + 1 : nullptr;
+                new (nodes + i) Node { copy(val), next };
+                i++;
+            }
+            res.m_head = nodes;
+            res.m_tail = nodes + m_size - 1;
+            res.m_size = m_size;
+            return res;
         }
 
         Iterator begin() { return Iterator(m_head); }
@@ -303,19 +498,42 @@ namespace alvo::ast::util {
         std::size_t m_size;
     };
 
-    class NodeCtx {
-    public:
-        NodeCtx(mem::Arena& arena) :
-            m_arena(&arena) { }
+}
 
-        template<typename T, typename... Args>
-        Ptr<T> make_node(Args&&... args) {
-            void* ptr = m_arena->alloc(sizeof(T), alignof(T));
-            return Ptr<T>(new (ptr) T(std::forward<Args>(args)...));
+namespace std {
+    // Hash by value, consistently with `operator==`, for the hashes of the
+    // nodes in the generated `ast.cpp`
+    template<typename T>
+    struct hash<alvo::ast::util::Ptr<T>> {
+        std::size_t operator()(
+            const alvo::ast::util::Ptr<T>& ptr) const noexcept {
+            return ptr.get_ptr() == nullptr ? 0 : std::hash<T>()(*ptr);
         }
+    };
 
-    private:
-        mem::Arena* m_arena;
+    template<typename T>
+    struct hash<alvo::ast::util::Array<T>> {
+        std::size_t operator()(
+            const alvo::ast::util::Array<T>& array) const noexcept {
+            std::size_t res = array.size();
+            for (std::size_t i = 0; i < array.size(); i++) {
+                res ^= std::hash<T>()(array[i]) + 0x9e3779b97f4a7c15ull +
+                       (res << 6) + (res >> 2);
+            }
+            return res;
+        }
     };
 
+    template<typename T>
+    struct hash<alvo::ast::util::List<T>> {
+        std::size_t operator()(
+            const alvo::ast::util::List<T>& list) const noexcept {
+            std::size_t res = list.size();
+            for (const T& val : list) {
+                res ^= std::hash<T>()(val) + 0x9e3779b97f4a7c15ull +
+                       (res << 6) + (res >> 2);
+            }
+            return res;
+        }
+    };
 }
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <functional>
 #include <variant>
 
 #include "tok.h"
+#include "util.h"
 
 namespace alvo::diag {
 
@@ -42,6 +42,19 @@ namespace alvo::diag {
 
         struct UnexpectedCharacterInNumberLiteral { };
 
+        struct InvalidUtf8 { };
+
+        struct IntegerLiteralTooLarge { };
+
+        struct ByteLiteralTooLarge { };
+
+        struct FloatingPointLiteralOutOfRange { };
+
+        struct UnknownEscapeSequence { };
+
+        // Character literals hold exactly one codepoint
+        struct InvalidCharacterLiteralLength { };
+
         // From parser
         struct UnexpectedToken {
             tok::Tok tok;
@@ -52,7 +65,10 @@ namespace alvo::diag {
             NonPrintableCharacterInStringLiteral, UnterminatedString,
             InvalidIntegerPrefix, NoDigitsAfterIntegerPrefix,
             BytePostfixInFloatingPointLiteral, NegativeByteLiteral,
-            UnexpectedCharacterInNumberLiteral, UnexpectedToken>;
+            UnexpectedCharacterInNumberLiteral, InvalidUtf8,
+            IntegerLiteralTooLarge, ByteLiteralTooLarge,
+            FloatingPointLiteralOutOfRange, UnknownEscapeSequence,
+            InvalidCharacterLiteralLength, UnexpectedToken>;
 
         Val val;
 
@@ -68,7 +84,8 @@ namespace alvo::diag {
         tok::Pos pos;
     };
 
-    using DiagHandler = std::function<void(const Diag&)>;
+    // The handler is referenced, not copied, and must outlive the emitter
+    using DiagHandler = util::FunctionRef<void(const Diag&)>;
 
     class DiagEmitter {
     public:
@@ -4,12 +4,22 @@
 
 #include <utility>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <iterator>
+#include <ranges>
+#include <string>
+#include <thread>
 
 namespace alvo::lex {
 
     using enum tok::TokKind;
 
+    // Keywords and the boolean literals
     static constexpr std::pair<std::string_view, tok::TokKind>
         _keyword_table[] = {
 
@@ -28,6 +38,7 @@ namespace alvo::lex {
             { "else", KwElse },
             { "enum", KwEnum },
             { "export", KwExport },
+            { "false", LitBoolean },
             { "float", KwFloat },
             { "for", KwFor },
             { "func", KwFunc },
@@ -46,6 +57,7 @@ namespace alvo::lex {
             { "struct", KwStruct },
             { "super", KwSuper },
             { "switch", KwSwitch },
+            { "true", LitBoolean },
             { "try_as", KwTryAs },
             { "tup", KwTup },
             { "type", KwType },
@@ -53,33 +65,137 @@ namespace alvo::lex {
             { "while", KwWhile },
         };
 
-    template<std::size_t N>
-    static constexpr bool _is_keyword_table_sorted(
-        const std::pair<std::string_view, tok::TokKind> (&arr)[N]) {
-        for (std::size_t i = 1; i < N; ++i) {
-            if (!(arr[i - 1].first < arr[i].first)) {
+    static constexpr std::size_t KEYWORD_HASH_BITS = 7;
+    static constexpr std::uint32_t KEYWORD_HASH_MULTIPLIER = 0xDF63;
+    static constexpr std::size_t KEYWORD_MIN_LENGTH = 2;
+    static constexpr std::size_t KEYWORD_MAX_LENGTH = 9;
+
+    // Multiplicative hash of the length and the first, second and last
+    // characters, `str` must be at least `KEYWORD_MIN_LENGTH` long
+    static constexpr std::uint32_t _keyword_hash(std::string_view str) {
+        std::uint32_t key = (std::uint32_t)(unsigned char)str[0] |
+                            (std::uint32_t)(unsigned char)str[1] << 8 |
+                            (std::uint32_t)(unsigned char)str.back() << 16 |
+                            (std::uint32_t)str.size() << 24;
+        return (key * KEYWORD_HASH_MULTIPLIER) >> (32 - KEYWORD_HASH_BITS);
+    }
+
+    // Index + 1 into `_keyword_table` for each hash, 0 for empty slots
+    using KeywordSlots = std::array<std::uint8_t, 1 << KEYWORD_HASH_BITS>;
+
+    // Whether every keyword fits the length bounds and gets its own slot
+    static constexpr bool _is_keyword_hash_perfect() {
+        KeywordSlots slots {};
+        for (const auto& [str, kind] : _keyword_table) {
+            if (str.size() < KEYWORD_MIN_LENGTH ||
+                str.size() > KEYWORD_MAX_LENGTH) {
+                return false;
+            }
+            if (slots[_keyword_hash(str)]++ != 0) {
                 return false;
             }
         }
         return true;
     }
 
-    static_assert(_is_keyword_table_sorted(_keyword_table),
-        "Keyword table must be sorted lexicographically");
+    static_assert(_is_keyword_hash_perfect(),
+        "Keyword hash must map every keyword to its own slot");
+
+    static constexpr KeywordSlots _make_keyword_slots() {
+        KeywordSlots res {};
+        for (std::size_t i = 0; i < std::size(_keyword_table); i++) {
+            res[_keyword_hash(_keyword_table[i].first)] = (std::uint8_t)(i + 1);
+        }
+        return res;
+    }
+
+    static constexpr KeywordSlots _keyword_slots = _make_keyword_slots();
 
     static std::optional<tok::TokKind> _lookup_keyword(std::string_view str) {
-        auto first = std::begin(_keyword_table);
-        auto last = std::end(_keyword_table);
+        if (str.size() < KEYWORD_MIN_LENGTH ||
+            str.size() > KEYWORD_MAX_LENGTH) {
+            return std::nullopt;
+        }
+        std::uint8_t slot = _keyword_slots[_keyword_hash(str)];
+        if (slot != 0 && _keyword_table[slot - 1].first == str) {
+            return _keyword_table[slot - 1].second;
+        }
+        return std::nullopt;
+    }
 
-        auto it = std::lower_bound(
-            first, last, str, [](const auto& pair, std::string_view str) {
-                return pair.first < str;
-            });
+    // Classes of ASCII characters, a character can be in several
+    using CharClass = std::uint8_t;
 
-        if (it != last && it->first == str)
-            return it->second;
+    static constexpr CharClass CC_SPACE = 1 << 0;
+    static constexpr CharClass CC_IDENT_START = 1 << 1;
+    static constexpr CharClass CC_IDENT_CONTINUE = 1 << 2;
+    static constexpr CharClass CC_DIGIT = 1 << 3;
+    static constexpr CharClass CC_HEX = 1 << 4;
+    static constexpr CharClass CC_SEP = 1 << 5;
+    static constexpr CharClass CC_QUOTE = 1 << 6;
+    // The NUL after the source, see `Lexer::advance`
+    static constexpr CharClass CC_SENTINEL = 1 << 7;
 
-        return std::nullopt;
+    static constexpr std::array<CharClass, 0x80> _make_char_class_table() {
+        std::array<CharClass, 0x80> res {};
+        for (char c : std::string_view(" \t\n\v\f\r")) {
+            res[c] |= CC_SPACE;
+        }
+        for (int c = 'a'; c <= 'z'; c++) {
+            res[c] |= CC_IDENT_START | CC_IDENT_CONTINUE;
+            res[c - 'a' + 'A'] |= CC_IDENT_START | CC_IDENT_CONTINUE;
+        }
+        res['_'] |= CC_IDENT_START | CC_IDENT_CONTINUE;
+        for (int c = '0'; c <= '9'; c++) {
+            res[c] |= CC_IDENT_CONTINUE | CC_DIGIT | CC_HEX;
+        }
+        for (int c = 'a'; c <= 'f'; c++) {
+            res[c] |= CC_HEX;
+            res[c - 'a' + 'A'] |= CC_HEX;
+        }
+        for (char c : std::string_view("(){}[]<>!:.,;=+-*/&|^~%?")) {
+            res[c] |= CC_SEP;
+        }
+        res['"'] |= CC_QUOTE;
+        res['\''] |= CC_QUOTE;
+        res['\0'] |= CC_SENTINEL;
+        return res;
+    }
+
+    static constexpr std::array<CharClass, 0x80> _char_class_table =
+        _make_char_class_table();
+
+    static_assert(_char_class_table[' '] == CC_SPACE);
+    static_assert(_char_class_table['f'] ==
+                  (CC_IDENT_START | CC_IDENT_CONTINUE | CC_HEX));
+    static_assert(_char_class_table[0x7F] == 0);
+
+    static bool _is_ascii(utf8::Codepoint c) {
+        return (std::uint32_t)c < 0x80;
+    }
+
+    // The classes of `c`, non-ASCII codepoints are in none of them
+    static CharClass _char_class(utf8::Codepoint c) {
+        return _is_ascii(c) ? _char_class_table[c] : 0;
+    }
+
+    static bool _is_space(utf8::Codepoint c) {
+        return _is_ascii(c) ? (_char_class_table[c] & CC_SPACE) != 0
+                            : utf8::is_space(c);
+    }
+
+    static bool _is_ident_start(utf8::Codepoint c) {
+        return _is_ascii(c) ? (_char_class_table[c] & CC_IDENT_START) != 0
+                            : utf8::is_alpha(c);
+    }
+
+    static bool _is_ident_continue(utf8::Codepoint c) {
+        return _is_ascii(c) ? (_char_class_table[c] & CC_IDENT_CONTINUE) != 0
+                            : utf8::is_alnum(c);
+    }
+
+    static bool _is_digit(utf8::Codepoint c) {
+        return (_char_class(c) & CC_DIGIT) != 0;
     }
 
     static bool _is_bin_digit(utf8::Codepoint c) {
@@ -91,40 +207,37 @@ namespace alvo::lex {
     }
 
     static bool _is_hex_digit(utf8::Codepoint c) {
-        return utf8::is_digit(c) || (L'a' <= c && c <= L'f') ||
-               (L'A' <= c && c <= L'F');
+        return (_char_class(c) & CC_HEX) != 0;
     }
 
     static bool _is_sep(utf8::Codepoint c) {
-        switch (c) {
-        case L'(':
-        case L')':
-        case L'{':
-        case L'}':
-        case L'[':
-        case L']':
-        case L'<':
-        case L'>':
-        case L'!':
-        case L':':
-        case L'.':
-        case L',':
-        case L';':
-        case L'=':
-        case L'+':
-        case L'-':
-        case L'*':
-        case L'/':
-        case L'&':
-        case L'|':
-        case L'^':
-        case L'~':
-        case L'%':
-        case L'?':
-            return true;
-        default:
-            return false;
+        return (_char_class(c) & CC_SEP) != 0;
+    }
+
+    // Value of an ASCII digit in any base up to 16
+    static std::uint64_t _digit_value(char ch) {
+        if (ch <= '9') {
+            return ch - '0';
         }
+        return (ch | 0x20) - 'a' + 10;
+    }
+
+    // Decodes `str` if it is exactly one codepoint. Literals come from the
+    // valid UTF-8 prefix, so the sequence needs no checks.
+    static std::optional<utf8::Codepoint> _decode_single(std::string_view str) {
+        utf8::Utf8Iter iter(str, str.size());
+        std::optional<utf8::Codepoint> res = iter.next();
+        if (!res || !iter.eof()) {
+            return std::nullopt;
+        }
+        return res;
+    }
+
+    // Whether `c` ends a number literal or an erroneous token
+    static bool _is_token_end(utf8::Codepoint c) {
+        return _is_ascii(c) ? (_char_class_table[c] &
+                                  (CC_SPACE | CC_SEP | CC_SENTINEL)) != 0
+                            : utf8::is_space(c);
     }
 
     TokEmitter::TokEmitter(TokHandler handler) :
@@ -132,17 +245,235 @@ namespace alvo::lex {
 
     void TokEmitter::emit(const tok::Tok& tok) { m_handler(tok); }
 
-    Lexer::Lexer(std::string_view src) :
+    static_assert((int)tok::TokKind::Count <= INT8_MAX &&
+                      (int)tok::TokKind::Continue >= INT8_MIN,
+        "Token kinds must fit in the one-byte kinds of TokenBuffer");
+
+    // Whether `tok` is a string literal without escapes, whose decoded value
+    // is a view into the source between the quotes
+    static bool _is_source_string(const tok::Tok& tok) {
+        const std::string_view* str = std::get_if<std::string_view>(&tok.lit);
+        return tok.kind == LitString && str != nullptr &&
+               str->data() == tok.value.data() + 1;
+    }
+
+    // Returns `lit` with a decoded string copied into `arena`
+    static tok::LitVal _copy_decoded(
+        const tok::LitVal& lit, mem::Arena& arena) {
+        const std::string_view* str = std::get_if<std::string_view>(&lit);
+        if (str == nullptr || str->empty()) {
+            return lit;
+        }
+        char* data = static_cast<char*>(arena.alloc(str->size(), 1));
+        std::memcpy(data, str->data(), str->size());
+        return std::string_view(data, str->size());
+    }
+
+    TokenBuffer::TokenBuffer(
+        std::string_view src, const sym::SymbolTable& symbols) :
         m_src(src),
-        m_src_iter(src),
+        m_symbols(&symbols),
+        m_kinds(),
+        m_starts(),
+        m_ends(),
+        m_payloads(),
+        m_gap_begin(0),
+        m_gap_size(0),
+        m_shift(0),
+        m_literals(),
+        m_free_literals(),
+        m_literal_arena(),
+        m_literal_bytes(0) { }
+
+    void TokenBuffer::push_back(const tok::Tok& tok) {
+        // Tokens are appended while a buffer is built, which has no gap
+        if (m_gap_begin != m_kinds.size()) [[unlikely]] {
+            move_gap(size());
+            m_kinds.resize(size());
+            m_starts.resize(size());
+            m_ends.resize(size());
+            m_payloads.resize(size());
+            m_gap_size = 0;
+            m_shift = 0;
+        }
+        m_gap_begin++;
+        m_kinds.push_back((std::int8_t)tok.kind);
+        m_starts.push_back(tok.loc.s.offset);
+        m_ends.push_back(tok.loc.e.offset);
+        if (!tok.symbol.is_null()) {
+            m_payloads.push_back(tok.symbol.id());
+        } else if (_is_source_string(tok)) {
+            // Taken from the source again by `lit()`, so no value points into
+            // the source and relexing can swap it
+            m_payloads.push_back(NO_PAYLOAD);
+        } else if (!std::holds_alternative<std::monostate>(tok.lit)) {
+            m_payloads.push_back((std::uint32_t)m_literals.size());
+            m_literals.push_back(tok.lit);
+        } else {
+            m_payloads.push_back(NO_PAYLOAD);
+        }
+    }
+
+    std::string_view TokenBuffer::value(std::size_t i) const {
+        tok::Loc res = loc(i);
+        return m_src.substr(res.s.offset, res.e.offset - res.s.offset);
+    }
+
+    sym::Symbol TokenBuffer::symbol(std::size_t i) const {
+        std::uint32_t payload = m_payloads[slot(i)];
+        if (kind(i) != Ident || payload == NO_PAYLOAD) {
+            return sym::Symbol();
+        }
+        return m_symbols->get(payload);
+    }
+
+    tok::LitVal TokenBuffer::lit(std::size_t i) const {
+        std::uint32_t payload = m_payloads[slot(i)];
+        if (kind(i) == LitString && payload == NO_PAYLOAD) {
+            std::string_view quoted = value(i);
+            return quoted.substr(1, quoted.size() - 2);
+        }
+        if (kind(i) == Ident || payload == NO_PAYLOAD) {
+            return tok::LitVal();
+        }
+        return m_literals[payload];
+    }
+
+    tok::Loc TokenBuffer::loc(std::size_t i) const {
+        std::size_t j = slot(i);
+        return tok::Loc(tok::Pos(m_starts[j] + shift(i)),
+            tok::Pos(m_ends[j] + shift(i)));
+    }
+
+    tok::Tok TokenBuffer::get(std::size_t i) const {
+        tok::Tok res(loc(i), kind(i), value(i), symbol(i));
+        res.lit = lit(i);
+        return res;
+    }
+
+    std::size_t TokenBuffer::get_memory_usage() const {
+        return size() * (sizeof(m_kinds[0]) + sizeof(m_starts[0]) +
+                            sizeof(m_ends[0]) + sizeof(m_payloads[0])) +
+               (m_literals.size() - m_free_literals.size()) *
+                   sizeof(m_literals[0]) +
+               (m_literal_arena != nullptr
+                       ? m_literal_arena->get_total_used()
+                       : 0);
+    }
+
+    void TokenBuffer::move_gap(std::size_t i) {
+        // Tokens that cross the gap switch between stored and shifted offsets
+        if (i < m_gap_begin) {
+            for (std::size_t j = m_gap_begin; j-- > i;) {
+                m_kinds[j + m_gap_size] = m_kinds[j];
+                m_starts[j + m_gap_size] = m_starts[j] - m_shift;
+                m_ends[j + m_gap_size] = m_ends[j] - m_shift;
+                m_payloads[j + m_gap_size] = m_payloads[j];
+            }
+        } else {
+            for (std::size_t j = m_gap_begin; j < i; j++) {
+                m_kinds[j] = m_kinds[j + m_gap_size];
+                m_starts[j] = m_starts[j + m_gap_size] + m_shift;
+                m_ends[j] = m_ends[j + m_gap_size] + m_shift;
+                m_payloads[j] = m_payloads[j + m_gap_size];
+            }
+        }
+        m_gap_begin = i;
+    }
+
+    void TokenBuffer::grow_gap(std::size_t size) {
+        if (m_gap_size >= size) {
+            return;
+        }
+        // Grown in proportion to the buffer, so moving the tokens after the
+        // gap is amortized over the tokens that fill it
+        std::size_t extra =
+            std::max(size - m_gap_size, m_kinds.size() / 8 + 16);
+        std::size_t tail = m_gap_begin + m_gap_size;
+        auto grow = [&](auto& arr) {
+            std::size_t old_size = arr.size();
+            arr.resize(old_size + extra);
+            std::move_backward(
+                arr.begin() + tail, arr.begin() + old_size, arr.end());
+        };
+        grow(m_kinds);
+        grow(m_starts);
+        grow(m_ends);
+        grow(m_payloads);
+        m_gap_size += extra;
+    }
+
+    std::uint32_t TokenBuffer::add_literal(const tok::LitVal& lit) {
+        const std::string_view* str = std::get_if<std::string_view>(&lit);
+        if (str != nullptr && m_literal_arena != nullptr &&
+            m_literal_arena->contains(str->data())) {
+            m_literal_bytes += str->size();
+        }
+        if (m_free_literals.empty()) {
+            m_literals.push_back(lit);
+            return (std::uint32_t)(m_literals.size() - 1);
+        }
+        std::uint32_t res = m_free_literals.back();
+        m_free_literals.pop_back();
+        m_literals[res] = lit;
+        return res;
+    }
+
+    void TokenBuffer::remove_literal(std::uint32_t index) {
+        const std::string_view* str =
+            std::get_if<std::string_view>(&m_literals[index]);
+        if (str != nullptr && m_literal_arena != nullptr &&
+            m_literal_arena->contains(str->data())) {
+            m_literal_bytes -= str->size();
+        }
+        m_literals[index] = tok::LitVal();
+        m_free_literals.push_back(index);
+    }
+
+    void TokenBuffer::compact_literals() {
+        if (m_literal_arena == nullptr) {
+            return;
+        }
+        std::size_t used = m_literal_arena->get_total_used();
+        if (used < LITERAL_COMPACT_MIN || used < 2 * m_literal_bytes) {
+            return;
+        }
+        auto arena = std::make_unique<mem::Arena>(4096);
+        for (tok::LitVal& lit : m_literals) {
+            const std::string_view* str = std::get_if<std::string_view>(&lit);
+            if (str != nullptr && m_literal_arena->contains(str->data())) {
+                lit = _copy_decoded(lit, *arena);
+            }
+        }
+        m_literal_arena = std::move(arena);
+    }
+
+    Lexer::Lexer(const source::SourceFile& source, sym::SymbolTable& symbols,
+        mem::Arena& literal_arena, diag::DiagEmitter* diag_emitter) :
+        Lexer(source, 0, source.get_src().size(),
+            utf8::valid_prefix_length(source.get_src()), &symbols,
+            &literal_arena, diag_emitter) { }
+
+    Lexer::Lexer(const source::SourceFile& source, std::size_t begin,
+        std::size_t end, std::size_t valid_end, sym::SymbolTable* symbols,
+        mem::Arena* literal_arena, diag::DiagEmitter* diag_emitter) :
+        m_src(source.get_src().substr(begin, end - begin)),
+        m_valid_size(std::min(valid_end, end) - begin),
+        // Only a fully valid suffix of the source ends in its sentinel
+        m_src_iter(m_src, m_valid_size,
+            end == source.get_src().size() && m_valid_size == m_src.size()),
         m_pos(),
         m_pos_next(),
         m_pos_begin(m_pos),
         m_curr(),
-        m_ch(m_src_iter.eof() ? 0 : m_src_iter.peek().value()),
-        m_eof(m_src_iter.eof()),
-        m_diag_emitter(nullptr),
+        m_ch(0),
+        m_invalid_utf8_reported(false),
+        m_symbols(symbols),
+        m_literal_arena(literal_arena),
+        m_diag_emitter(diag_emitter),
         m_tok_emitter(nullptr) {
+        // Load the first character, `m_ch` is always the one at `m_pos`
+        advance();
         next();
     }
 
@@ -164,16 +495,31 @@ namespace alvo::lex {
     }
 
     tok::Tok Lexer::lex_string() {
-        if (m_ch == L'"' || m_ch == L'\'') {
+        if (_char_class(m_ch) & CC_QUOTE) {
             bool is_char = false;
             if (m_ch == L'\'') {
                 is_char = true;
             }
+            char quote = is_char ? '\'' : '"';
             advance();
             bool escaped = false;
             bool closed = false;
-            while (!m_eof) {
+            while (true) {
+                // Jump over plain printable ASCII, only the quote, escapes,
+                // control bytes and non-ASCII need a look at the codepoint
+                if (!escaped) {
+                    std::size_t run = utf8::quoted_run_length(
+                        m_src.substr(m_pos.offset, m_valid_size - m_pos.offset),
+                        quote);
+                    if (run > 0) {
+                        skip_to(m_pos.offset + run);
+                    }
+                }
                 if (!utf8::is_print(m_ch)) {
+                    // The sentinel is not printable either
+                    if (m_ch == 0 && at_end()) {
+                        break;
+                    }
                     if (is_char) {
                         return create_err_and_emit({ diag::Err::
                                 NonPrintableCharacterInCharacterLiteral {} });
@@ -200,17 +546,13 @@ namespace alvo::lex {
                     { diag::Err::UnterminatedString {} });
             }
             advance();
-            if (is_char) {
-                return create_tok(LitCharacter);
-            } else {
-                return create_tok(LitString);
-            }
+            return decode_quoted(is_char);
         }
         return create_tok(None);
     }
 
     tok::Tok Lexer::lex_num(bool negative) {
-        if (utf8::is_digit(m_ch)) {
+        if (_is_digit(m_ch)) {
             bool has_dot = false;
             bool has_digit_after_prefix = false;
             bool has_byte_postfix = false;
@@ -231,11 +573,14 @@ namespace alvo::lex {
                     base = 16;
                     break;
                 case L'.':
-                    has_dot = true;
-                    break;
+                    if (_is_digit(peek_ch())) {
+                        has_dot = true;
+                        break;
+                    }
+                    return decode_num(LitInteger, 10);
                 default:
-                    if (utf8::is_space(m_ch) || _is_sep(m_ch)) {
-                        return create_tok(LitInteger);
+                    if (_is_token_end(m_ch)) {
+                        return decode_num(LitInteger, 10);
                     }
                     return create_err_and_emit(
                         { diag::Err::InvalidIntegerPrefix {} });
@@ -243,28 +588,22 @@ namespace alvo::lex {
             }
 
             advance();
-            while (!m_eof) {
+            while (true) {
                 if (m_ch == L'.' && base == 10) {
-                    if (has_dot) {
+                    // The number ends before a dot that no digit follows
+                    if (has_dot || !_is_digit(peek_ch())) {
                         break;
                     }
                     has_dot = true;
-                    Lexer saved_state = *this;
-                    advance();
-                    if (!utf8::is_digit(m_ch)) {
-                        *this = saved_state;
-                        has_dot = false;
-                        break;
-                    }
                 } else if (base == 2 && _is_bin_digit(m_ch)) {
                     has_digit_after_prefix = true;
                 } else if (base == 8 && _is_oct_digit(m_ch)) {
                     has_digit_after_prefix = true;
-                } else if (base == 10 && utf8::is_digit(m_ch)) {
+                } else if (base == 10 && _is_digit(m_ch)) {
                     // OK
                 } else if (base == 16 && _is_hex_digit(m_ch)) {
                     has_digit_after_prefix = true;
-                } else if ((_is_sep(m_ch) || utf8::is_space(m_ch))) {
+                } else if (_is_token_end(m_ch)) {
                     if (base != 10 && !has_digit_after_prefix) {
                         return create_err_and_emit(
                             { diag::Err::NoDigitsAfterIntegerPrefix {} });
@@ -304,31 +643,159 @@ namespace alvo::lex {
             } else {
                 kind = LitInteger;
             }
-            return create_tok(kind);
+            return decode_num(kind, base);
         }
         return create_tok(None);
     }
 
-    tok::Tok Lexer::lex_word() {
-        if (utf8::is_alpha(m_ch) || m_ch == L'_') {
-            advance();
-            while (!m_eof) {
-                if (utf8::is_alnum(m_ch) || m_ch == L'_') {
-                    advance();
-                } else {
+    tok::Tok Lexer::decode_num(tok::TokKind kind, int base) {
+        std::string_view value = get_curr_value();
+        std::string_view digits = value;
+        if (base != 10) {
+            digits.remove_prefix(2);
+        }
+        if (kind == LitByte) {
+            digits.remove_suffix(1);
+        }
+
+        if (kind == LitFloating) {
+            // `from_chars` rounds correctly and takes the Eisel-Lemire fast
+            // path where it can, separators have to go first. Long literals
+            // are stripped into the literal arena instead of the stack.
+            char small[64];
+            if (digits.find('_') != std::string_view::npos) {
+                char* out = digits.size() <= sizeof(small)
+                                ? small
+                                : static_cast<char*>(
+                                      m_literal_arena->alloc(digits.size(), 1));
+                std::size_t size = 0;
+                for (char ch : digits) {
+                    if (ch != '_') {
+                        out[size++] = ch;
+                    }
+                }
+                digits = std::string_view(out, size);
+            }
+            double res = 0.0;
+            std::from_chars_result parsed =
+                std::from_chars(digits.data(), digits.data() + digits.size(),
+                    res, std::chars_format::fixed);
+            if (parsed.ec != std::errc()) {
+                return create_err_and_emit(
+                    { diag::Err::FloatingPointLiteralOutOfRange {} },
+                    m_pos_begin);
+            }
+            return tok::Tok({ m_pos_begin, m_pos }, kind, value, res);
+        }
+
+        std::uint64_t max = kind == LitByte ? UINT8_MAX : UINT64_MAX;
+        std::uint64_t res = 0;
+        for (char ch : digits) {
+            if (ch == '_') {
+                continue;
+            }
+            std::uint64_t digit = _digit_value(ch);
+            if (res > (max - digit) / (std::uint64_t)base) {
+                if (kind == LitByte) {
+                    return create_err_and_emit(
+                        { diag::Err::ByteLiteralTooLarge {} }, m_pos_begin);
+                }
+                return create_err_and_emit(
+                    { diag::Err::IntegerLiteralTooLarge {} }, m_pos_begin);
+            }
+            res = res * base + digit;
+        }
+        if (kind == LitByte) {
+            return tok::Tok(
+                { m_pos_begin, m_pos }, kind, value, (std::uint8_t)res);
+        }
+        return tok::Tok({ m_pos_begin, m_pos }, kind, value, res);
+    }
+
+    tok::Tok Lexer::decode_quoted(bool is_char) {
+        std::string_view value = get_curr_value();
+        std::string_view body = value.substr(1, value.size() - 2);
+        tok::TokKind kind = is_char ? LitCharacter : LitString;
+
+        // Escapes only ever shorten the text
+        char small[4];
+        char* out = small;
+        if (!is_char) {
+            if (body.find('\\') == std::string_view::npos) {
+                return tok::Tok({ m_pos_begin, m_pos }, kind, value, body);
+            }
+            out = static_cast<char*>(m_literal_arena->alloc(body.size(), 1));
+        } else if (body.size() > sizeof(small)) {
+            return create_err_and_emit(
+                { diag::Err::InvalidCharacterLiteralLength {} }, m_pos_begin);
+        }
+
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < body.size(); i++) {
+            char ch = body[i];
+            if (ch == '\\') {
+                i++;
+                switch (body[i]) {
+                case 'n':
+                    ch = '\n';
+                    break;
+                case 'r':
+                    ch = '\r';
+                    break;
+                case 't':
+                    ch = '\t';
+                    break;
+                case '0':
+                    ch = '\0';
                     break;
+                case '\\':
+                case '\'':
+                case '"':
+                    ch = body[i];
+                    break;
+                default:
+                    // At the backslash, `body` starts after the quote
+                    return create_err_and_emit(
+                        { diag::Err::UnknownEscapeSequence {} },
+                        tok::Pos(m_pos_begin.offset + (std::uint32_t)i));
                 }
             }
+            out[size++] = ch;
+        }
+
+        if (!is_char) {
+            return tok::Tok({ m_pos_begin, m_pos }, kind, value,
+                std::string_view(out, size));
+        }
+        std::optional<utf8::Codepoint> codepoint =
+            _decode_single(std::string_view(out, size));
+        if (!codepoint) {
+            return create_err_and_emit(
+                { diag::Err::InvalidCharacterLiteralLength {} }, m_pos_begin);
+        }
+        return tok::Tok({ m_pos_begin, m_pos }, kind, value, *codepoint);
+    }
+
+    tok::Tok Lexer::lex_word() {
+        if (_is_ident_start(m_ch)) {
+            advance();
+            while (_is_ident_continue(m_ch)) {
+                advance();
+            }
             std::string_view value = get_curr_value();
             std::optional<tok::TokKind> keyword_kind = _lookup_keyword(value);
+            if (keyword_kind == LitBoolean) {
+                // The lookup matched `true` or `false`, the length tells
+                // them apart
+                return tok::Tok({ m_pos_begin, m_pos }, LitBoolean, value,
+                    value.size() == 4);
+            }
             if (keyword_kind) {
                 return create_tok(*keyword_kind);
             } else {
-                if (value == "true" || value == "false") {
-                    return create_tok(LitBoolean);
-                } else {
-                    return create_tok(Ident);
-                }
+                return tok::Tok({ m_pos_begin, m_pos }, Ident, value,
+                    m_symbols != nullptr ? m_symbols->intern(value)
+                                         : sym::Symbol());
             }
         }
         return create_tok(None);
@@ -365,15 +832,15 @@ namespace alvo::lex {
             case L'<':
                 sym_kind = LAngle;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = LAngleEq;
                     advance();
                     break;
                 }
-                if (m_ch == L'<' && !m_eof) {
+                if (m_ch == L'<') {
                     sym_kind = LAngleLAngle;
                     advance();
-                    if (m_ch == L'=' && !m_eof) {
+                    if (m_ch == L'=') {
                         sym_kind = LAngleLAngleEq;
                         advance();
                         break;
@@ -384,15 +851,15 @@ namespace alvo::lex {
             case L'>':
                 sym_kind = RAngle;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = RAngleEq;
                     advance();
                     break;
                 }
-                if (m_ch == L'>' && !m_eof) {
+                if (m_ch == L'>') {
                     sym_kind = RAngleRAngle;
                     advance();
-                    if (m_ch == L'=' && !m_eof) {
+                    if (m_ch == L'=') {
                         sym_kind = RAngleRAngleEq;
                         advance();
                         break;
@@ -403,7 +870,7 @@ namespace alvo::lex {
             case L'!':
                 sym_kind = Exclam;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = ExclamEq;
                     advance();
                     break;
@@ -412,7 +879,7 @@ namespace alvo::lex {
             case L':':
                 sym_kind = Colon;
                 advance();
-                if (m_ch == L':' && !m_eof) {
+                if (m_ch == L':') {
                     sym_kind = ColonColon;
                     advance();
                     break;
@@ -433,12 +900,12 @@ namespace alvo::lex {
             case L'=':
                 sym_kind = Eq;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = EqEq;
                     advance();
                     break;
                 }
-                if (m_ch == L'>' && !m_eof) {
+                if (m_ch == L'>') {
                     sym_kind = EqRAngle;
                     advance();
                     break;
@@ -447,7 +914,7 @@ namespace alvo::lex {
             case L'+':
                 sym_kind = Plus;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = PlusEq;
                     advance();
                     break;
@@ -456,12 +923,12 @@ namespace alvo::lex {
             case L'-': {
                 sym_kind = Dash;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = DashEq;
                     advance();
                     break;
                 }
-                if (m_ch == L'>' && !m_eof) {
+                if (m_ch == L'>') {
                     sym_kind = DashRAngle;
                     advance();
                     break;
@@ -476,7 +943,7 @@ namespace alvo::lex {
             case L'*':
                 sym_kind = Star;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = StarEq;
                     advance();
                     break;
@@ -485,28 +952,32 @@ namespace alvo::lex {
             case L'/':
                 sym_kind = Slash;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = SlashEq;
                     advance();
                     break;
                 }
                 // Skip comments
                 if (m_ch == L'/') {
-                    while (!m_eof && m_ch != L'\n') {
-                        advance();
-                    }
+                    // Up to the newline or the end of the valid prefix
+                    const void* newline =
+                        std::memchr(m_src.data() + m_pos.offset, '\n',
+                            m_valid_size - m_pos.offset);
+                    skip_to(newline != nullptr
+                                ? (const char*)newline - m_src.data()
+                                : m_valid_size);
                     return create_tok(Continue);
                 }
                 break;
             case L'&':
                 sym_kind = Amp;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = AmpEq;
                     advance();
                     break;
                 }
-                if (m_ch == L'&' && !m_eof) {
+                if (m_ch == L'&') {
                     sym_kind = AmpAmp;
                     advance();
                     break;
@@ -515,12 +986,12 @@ namespace alvo::lex {
             case L'|':
                 sym_kind = Pipe;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = PipeEq;
                     advance();
                     break;
                 }
-                if (m_ch == L'|' && !m_eof) {
+                if (m_ch == L'|') {
                     sym_kind = PipePipe;
                     advance();
                     break;
@@ -529,7 +1000,7 @@ namespace alvo::lex {
             case L'^':
                 sym_kind = Caret;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = CaretEq;
                     advance();
                     break;
@@ -542,7 +1013,7 @@ namespace alvo::lex {
             case L'%':
                 sym_kind = Percent;
                 advance();
-                if (m_ch == L'=' && !m_eof) {
+                if (m_ch == L'=') {
                     sym_kind = PercentEq;
                     advance();
                     break;
@@ -560,80 +1031,347 @@ namespace alvo::lex {
 
     tok::Tok Lexer::peek() const { return m_curr; }
 
-    tok::Tok Lexer::get_token() {
-        while (true) {
-            m_pos_begin = m_pos;
+    TokenBuffer Lexer::tokenize_all() {
+        TokenBuffer res(m_src, *m_symbols);
+        lex_into(res);
+        return res;
+    }
 
-            if (m_eof) {
-                return create_tok(Eof);
+    TokenBuffer Lexer::tokenize_parallel(const source::SourceFile& source,
+        sym::SymbolTable& symbols, mem::Arena& literal_arena,
+        std::size_t chunk_count, diag::DiagEmitter* diag_emitter) {
+        std::string_view src = source.get_src();
+        std::size_t valid_size = utf8::valid_prefix_length(src);
+
+        // Chunk boundaries go right after the first newline past each even
+        // split point. Only the valid prefix is split, the last chunk takes
+        // the rest so it reports invalid UTF-8 like a sequential lexer.
+        std::vector<std::size_t> bounds { 0 };
+        std::size_t step = valid_size / std::max<std::size_t>(chunk_count, 1);
+        for (std::size_t i = 1; i < chunk_count && step > 0; i++) {
+            std::size_t from = std::max(i * step, bounds.back());
+            const void* newline = std::memchr(
+                src.data() + from, '\n', valid_size - from);
+            if (newline == nullptr) {
+                break;
             }
+            bounds.push_back((const char*)newline - src.data() + 1);
+        }
+        bounds.push_back(src.size());
+        std::size_t chunks = bounds.size() - 1;
 
-            if (utf8::is_space(m_ch)) {
-                advance();
-                continue;
+        // Chunks don't intern identifiers or report diagnostics themselves,
+        // both happen in source order while stitching. Decoded strings go to
+        // an arena per chunk and are copied out while stitching.
+        std::vector<TokenBuffer> buffers;
+        std::vector<std::vector<diag::Diag>> diags(chunks);
+        struct CollectDiags {
+            std::vector<diag::Diag>* diags;
+
+            void operator()(const diag::Diag& diag) const {
+                diags->push_back(diag);
             }
+        };
+        std::vector<CollectDiags> collectors;
+        std::vector<diag::DiagEmitter> diag_emitters;
+        std::deque<mem::Arena> arenas;
+        buffers.reserve(chunks);
+        // Emitters refer to the collectors, which must not move
+        collectors.reserve(chunks);
+        diag_emitters.reserve(chunks);
+        for (std::size_t i = 0; i < chunks; i++) {
+            buffers.emplace_back(
+                src.substr(bounds[i], bounds[i + 1] - bounds[i]), symbols);
+            arenas.emplace_back(4096);
+            collectors.push_back(CollectDiags { &diags[i] });
+            diag_emitters.emplace_back(collectors.back());
+        }
+        // The emitter is passed on construction, which already lexes the
+        // first token of the chunk
+        auto lex_chunk = [&](std::size_t i) {
+            Lexer lexer(source, bounds[i], bounds[i + 1], valid_size, nullptr,
+                &arenas[i], &diag_emitters[i]);
+            lexer.lex_into(buffers[i]);
+        };
 
-            tok::Tok string_tok = lex_string();
-            if (string_tok.is_continue()) {
-                continue;
+        // One worker per hardware thread at most, the caller included, each
+        // takes the next unlexed chunk until none are left
+        std::size_t worker_count = std::min<std::size_t>(
+            chunks, std::max(std::thread::hardware_concurrency(), 1u));
+        std::atomic<std::size_t> next_chunk = 0;
+        auto work = [&]() {
+            for (std::size_t i = next_chunk++; i < chunks; i = next_chunk++) {
+                lex_chunk(i);
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(worker_count - 1);
+        for (std::size_t i = 1; i < worker_count; i++) {
+            threads.emplace_back(work);
+        }
+        work();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        TokenBuffer res(src, symbols);
+        std::size_t total = 0;
+        for (const TokenBuffer& buffer : buffers) {
+            total += buffer.size();
+        }
+        res.m_kinds.reserve(total);
+        res.m_starts.reserve(total);
+        res.m_ends.reserve(total);
+        res.m_payloads.reserve(total);
+        for (std::size_t i = 0; i < chunks; i++) {
+            const TokenBuffer& buffer = buffers[i];
+            std::uint32_t base = (std::uint32_t)bounds[i];
+            // Every chunk but the last ends in an `Eof` that isn't one
+            std::size_t count = buffer.size() - (i + 1 < chunks ? 1 : 0);
+            for (std::size_t j = 0; j < count; j++) {
+                res.m_kinds.push_back(buffer.m_kinds[j]);
+                res.m_starts.push_back(buffer.m_starts[j] + base);
+                res.m_ends.push_back(buffer.m_ends[j] + base);
+                if (buffer.kind(j) == Ident) {
+                    res.m_payloads.push_back(
+                        symbols.intern(buffer.value(j)).id());
+                } else if (buffer.m_payloads[j] != TokenBuffer::NO_PAYLOAD) {
+                    res.m_payloads.push_back(
+                        (std::uint32_t)res.m_literals.size());
+                    res.m_literals.push_back(_copy_decoded(
+                        buffer.m_literals[buffer.m_payloads[j]],
+                        literal_arena));
+                } else {
+                    res.m_payloads.push_back(TokenBuffer::NO_PAYLOAD);
+                }
             }
-            if (!string_tok.is_none()) {
-                return string_tok;
+            if (diag_emitter != nullptr) {
+                for (diag::Diag& diag : diags[i]) {
+                    diag.pos.offset += base;
+                    diag_emitter->emit(diag);
+                }
             }
+        }
+        res.m_gap_begin = res.m_kinds.size();
+        return res;
+    }
 
-            tok::Tok num_tok = lex_num(false);
-            if (num_tok.is_continue()) {
-                continue;
+    void Lexer::relex(TokenBuffer& tokens, const source::SourceFile& source,
+        const Edit& edit, sym::SymbolTable& symbols,
+        diag::DiagEmitter* diag_emitter) {
+        std::string_view src = source.get_src();
+        std::size_t edit_end = edit.begin + edit.text.size();
+        // `Eof` of `tokens` is where its lexer stopped, at the end of the
+        // valid UTF-8 prefix, so everything before it may have to be relexed
+        std::size_t old_valid = tokens.loc(tokens.size() - 1).s.offset;
+
+        // Nothing spans a newline, so a lexer started at a line start is in
+        // the same state as one that lexed everything before it
+        std::size_t anchor = std::min(edit.begin, old_valid);
+        std::size_t line_start =
+            anchor == 0 ? std::string_view::npos : src.rfind('\n', anchor - 1);
+        line_start = line_start == std::string_view::npos ? 0 : line_start + 1;
+
+        // Validate up to the first codepoint start after the edit. Past it
+        // the bytes are the same as before, so they stay valid up to where
+        // the old prefix ended, unless that was before this point.
+        std::size_t sync = edit_end;
+        while (sync < src.size() && ((unsigned char)src[sync] & 0xC0) == 0x80) {
+            sync++;
+        }
+        std::size_t valid = line_start +
+                            utf8::valid_prefix_length(
+                                src.substr(line_start, sync - line_start));
+        if (valid == sync && sync < src.size()) {
+            std::size_t old_sync = sync - edit_end + edit.end;
+            if (old_sync <= old_valid) {
+                valid = old_valid - edit.end + edit_end;
+            } else {
+                valid = sync + utf8::valid_prefix_length(src.substr(sync));
             }
-            if (!num_tok.is_none()) {
-                return num_tok;
+        }
+
+        std::size_t kept = *std::ranges::partition_point(
+            std::views::iota(std::size_t(0), tokens.size()),
+            [&](std::size_t i) { return tokens.loc(i).s.offset < line_start; });
+
+        auto shift_diag = [&](const diag::Diag& diag) {
+            if (diag_emitter != nullptr) {
+                diag::Diag shifted = diag;
+                shifted.pos.offset += line_start;
+                diag_emitter->emit(shifted);
             }
+        };
+        diag::DiagEmitter line_diag_emitter(shift_diag);
+        if (tokens.m_literal_arena == nullptr) {
+            tokens.m_literal_arena = std::make_unique<mem::Arena>(4096);
+        }
+        Lexer lexer(source, line_start, src.size(), valid, &symbols,
+            tokens.m_literal_arena.get(), &line_diag_emitter);
+        // Tokens are taken from `m_curr` and the next one is only lexed when
+        // needed, so no diagnostics are emitted past the point of resync
+        TokenBuffer relexed(src, symbols);
+        std::size_t old_index = kept;
+        std::size_t old_end = tokens.size();
+        while (true) {
+            tok::Tok tok = lexer.m_curr;
+            tok.loc.s.offset += line_start;
+            tok.loc.e.offset += line_start;
 
-            tok::Tok word_tok = lex_word();
-            if (word_tok.is_continue()) {
-                continue;
+            // A token after the edit that starts where an old one did is
+            // lexed from the same bytes in the same state, as is the rest
+            if (tok.loc.s.offset >= edit_end) {
+                std::size_t old_start = tok.loc.s.offset - edit_end + edit.end;
+                while (old_index < tokens.size() &&
+                       tokens.loc(old_index).s.offset < old_start) {
+                    old_index++;
+                }
+                if (old_index < tokens.size() &&
+                    tokens.loc(old_index).s.offset == old_start) {
+                    old_end = old_index;
+                    break;
+                }
             }
-            if (!word_tok.is_none()) {
-                return word_tok;
+
+            relexed.push_back(tok);
+            if (tok.is_eof()) {
+                break;
             }
+            lexer.m_curr = lexer.get_token();
+        }
 
-            tok::Tok sym_tok = lex_sym();
-            if (sym_tok.is_continue()) {
-                continue;
+        // The gap takes the replaced tokens `[kept, old_end)`, freeing their
+        // literal slots, and the relexed tokens fill it from the front
+        tokens.move_gap(kept);
+        for (std::size_t i = kept; i < old_end; i++) {
+            std::size_t slot = tokens.slot(i);
+            if (tokens.m_kinds[slot] != (std::int8_t)Ident &&
+                tokens.m_payloads[slot] != TokenBuffer::NO_PAYLOAD) {
+                tokens.remove_literal(tokens.m_payloads[slot]);
             }
-            if (!sym_tok.is_none()) {
-                return sym_tok;
+        }
+        tokens.m_gap_size += old_end - kept;
+        tokens.grow_gap(relexed.size());
+        for (std::size_t i = 0; i < relexed.size(); i++) {
+            std::size_t slot = kept + i;
+            tokens.m_kinds[slot] = relexed.m_kinds[i];
+            tokens.m_starts[slot] = relexed.m_starts[i];
+            tokens.m_ends[slot] = relexed.m_ends[i];
+            std::uint32_t payload = relexed.m_payloads[i];
+            if (relexed.kind(i) != Ident &&
+                payload != TokenBuffer::NO_PAYLOAD) {
+                payload = tokens.add_literal(relexed.m_literals[payload]);
             }
+            tokens.m_payloads[slot] = payload;
+        }
+        tokens.m_gap_begin += relexed.size();
+        tokens.m_gap_size -= relexed.size();
+        // Offsets after the gap move by the size change of the edit
+        tokens.m_shift += (std::uint32_t)edit_end - (std::uint32_t)edit.end;
+        tokens.m_src = src;
+        tokens.compact_literals();
+    }
 
-            return create_err_and_emit({ diag::Err::UnexpectedCharacter {} });
+    void Lexer::lex_into(TokenBuffer& res) {
+        if (m_tok_emitter != nullptr) {
+            // The trailing `Eof` is stored but not emitted, it only ends the
+            // buffer
+            while (!m_curr.is_eof()) {
+                res.push_back(next());
+            }
+            res.push_back(m_curr);
+            return;
+        }
+        // Same as `next()` without checking for an emitter on every token
+        while (true) {
+            res.push_back(m_curr);
+            if (m_curr.is_eof()) {
+                return;
+            }
+            m_curr = get_token();
+        }
+    }
+
+    tok::Tok Lexer::get_token() {
+        while (true) {
+            m_pos_begin = m_pos;
+
+            if (m_ch == 0 && at_end()) {
+                if (m_valid_size < m_src.size() && !m_invalid_utf8_reported) {
+                    m_invalid_utf8_reported = true;
+                    if (m_diag_emitter != nullptr) {
+                        m_diag_emitter->emit(
+                            { diag::Err { diag::Err::InvalidUtf8 {} }, m_pos });
+                    }
+                    return create_tok(Err);
+                }
+                return create_tok(Eof);
+            }
+
+            if (_is_space(m_ch)) {
+                advance();
+                continue;
+            }
+
+            CharClass cls = _char_class(m_ch);
+            tok::Tok tok;
+            if (cls & CC_QUOTE) {
+                tok = lex_string();
+            } else if (cls & CC_DIGIT) {
+                tok = lex_num(false);
+            } else if (_is_ident_start(m_ch)) {
+                tok = lex_word();
+            } else if (cls & CC_SEP) {
+                tok = lex_sym();
+            } else {
+                return create_err_and_emit(
+                    { diag::Err::UnexpectedCharacter {} });
+            }
+            if (tok.is_continue()) {
+                continue;
+            }
+            return tok;
         }
     }
 
     void Lexer::advance() {
         m_pos = m_pos_next;
         m_pos_next.offset = m_src_iter.byte_offset();
-        std::optional<utf8::Codepoint> codepoint = m_src_iter.next();
-        m_pos_next.c++;
-        if (codepoint) {
-            m_ch = codepoint.value();
-            if (codepoint.value() == L'\n') {
-                m_pos_next.l++;
-                m_pos_next.c = 1;
-            }
-        } else {
-            m_eof = true;
+        // The iterator reads the sentinel itself where the source has one,
+        // past a chunk or an invalid byte there is only the empty optional
+        m_ch = m_src_iter.next().value_or(0);
+    }
+
+    bool Lexer::at_end() const { return m_pos.offset >= m_valid_size; }
+
+    utf8::Codepoint Lexer::peek_ch(std::size_t n) const {
+        if (n == 0) {
+            return m_ch;
         }
+        std::optional<utf8::Codepoint> codepoint = m_src_iter.peek(n - 1);
+        return codepoint ? codepoint.value() : 0;
+    }
+
+    void Lexer::skip_to(std::size_t offset) {
+        m_src_iter.seek(offset);
+        m_pos_next.offset = offset;
+        advance();
     }
 
     void Lexer::recover() {
-        while (!utf8::is_space(m_ch) && !_is_sep(m_ch) && !m_eof) {
+        // Only the sentinel ends recovery, a NUL inside the source doesn't
+        while (!_is_token_end(m_ch) || (m_ch == 0 && !at_end())) {
             advance();
         }
     }
 
     tok::Tok Lexer::create_err_and_emit(diag::Err err) {
+        return create_err_and_emit(err, m_pos);
+    }
+
+    tok::Tok Lexer::create_err_and_emit(diag::Err err, tok::Pos pos) {
         if (m_diag_emitter != nullptr) {
-            m_diag_emitter->emit({ err, m_pos });
+            m_diag_emitter->emit({ err, pos });
         }
         recover();
         return create_tok(tok::TokKind::Err);
@@ -1,17 +1,24 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string_view>
-#include <functional>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "utf8.h"
 #include "diag.h"
+#include "mem.h"
 #include "tok.h"
+#include "source.h"
+#include "sym.h"
+#include "util.h"
 
 namespace alvo::lex {
 
-    using TokHandler = std::function<void(const tok::Tok&)>;
+    using TokHandler = util::FunctionRef<void(const tok::Tok&)>;
 
     class TokEmitter {
     public:
@@ -23,10 +30,118 @@ namespace alvo::lex {
         TokHandler m_handler;
     };
 
-    class Lexer {
+    // Tokens of a whole source as parallel arrays of one-byte kinds, start
+    // and end byte offsets and payloads, which are symbol ids or indices of
+    // decoded literal values. Values are views into the source, so a full
+    // `tok::Tok` is only built when one is asked for.
+    //
+    // The arrays are gap buffers: `Lexer::relex()` leaves a gap of unused
+    // slots after the tokens it relexed, so the next edit only moves the
+    // tokens between the two edits. Offsets of the tokens after the gap are
+    // stored without the size change of the edits, which is added on access.
+    class TokenBuffer {
     public:
-        Lexer(std::string_view src);
+        TokenBuffer(std::string_view src, const sym::SymbolTable& symbols);
+
+        void push_back(const tok::Tok& tok);
+
+        std::size_t size() const { return m_kinds.size() - m_gap_size; }
+
+        tok::TokKind kind(std::size_t i) const {
+            return (tok::TokKind)m_kinds[slot(i)];
+        }
+
+        std::string_view value(std::size_t i) const;
+
+        sym::Symbol symbol(std::size_t i) const;
+
+        tok::LitVal lit(std::size_t i) const;
+
+        tok::Loc loc(std::size_t i) const;
+
+        tok::Tok get(std::size_t i) const;
+
+        // Bytes used by the token arrays, literal values and the strings
+        // decoded by relexing, not counting spare capacity
+        std::size_t get_memory_usage() const;
+
+    private:
+        static constexpr std::uint32_t NO_PAYLOAD = UINT32_MAX;
+
+        // Relexed strings are compacted once garbage makes up more than
+        // half of their arena and the arena has grown past this
+        static constexpr std::size_t LITERAL_COMPACT_MIN = 16 * 1024;
+
+        // Index into the arrays of the token at `i`
+        std::size_t slot(std::size_t i) const {
+            return i < m_gap_begin ? i : i + m_gap_size;
+        }
+
+        // Amount to add to the stored offsets of the token at `i`
+        std::uint32_t shift(std::size_t i) const {
+            return i < m_gap_begin ? 0 : m_shift;
+        }
+
+        // Moves the gap to right before the token at `i`
+        void move_gap(std::size_t i);
+
+        // Makes the gap at least `size` slots long
+        void grow_gap(std::size_t size);
+
+        // Stores `lit` in a free slot of `m_literals` and returns its index
+        std::uint32_t add_literal(const tok::LitVal& lit);
+
+        void remove_literal(std::uint32_t index);
 
+        // Copies the live relexed strings into a new arena once most of the
+        // current one is garbage
+        void compact_literals();
+
+        std::string_view m_src;
+        const sym::SymbolTable* m_symbols;
+        std::vector<std::int8_t> m_kinds;
+        std::vector<std::uint32_t> m_starts;
+        std::vector<std::uint32_t> m_ends;
+        // Symbol id of `Ident` tokens, index into `m_literals` of literals
+        std::vector<std::uint32_t> m_payloads;
+        // Index of the first token after the gap, `size()` if the gap is at
+        // the end
+        std::size_t m_gap_begin;
+        std::size_t m_gap_size;
+        // Added modulo 2^32 to the offsets of the tokens after the gap
+        std::uint32_t m_shift;
+        std::vector<tok::LitVal> m_literals;
+        // Slots of `m_literals` whose tokens were relexed away
+        std::vector<std::uint32_t> m_free_literals;
+        // Strings decoded by relexing, with the bytes of those still in use
+        std::unique_ptr<mem::Arena> m_literal_arena;
+        std::size_t m_literal_bytes;
+
+        // Stitches per-chunk buffers together in `Lexer::tokenize_parallel()`
+        // and splices relexed tokens in `Lexer::relex()`
+        friend class Lexer;
+    };
+
+    // Replacement of the bytes `[begin, end)` of a source with `text`
+    struct Edit {
+        std::size_t begin;
+        std::size_t end;
+        std::string_view text;
+    };
+
+    class Lexer {
+    public:
+        // Identifiers are interned into `symbols`, string literals with
+        // escapes are decoded into `literal_arena`. The end of `source` reads
+        // as a NUL, so inner loops stop on it like on any other character
+        // that can't continue a token, only NULs are checked with `at_end()`.
+        // The first token is lexed here, so its diagnostics only reach
+        // `diag_emitter`.
+        Lexer(const source::SourceFile& source, sym::SymbolTable& symbols,
+            mem::Arena& literal_arena,
+            diag::DiagEmitter* diag_emitter = nullptr);
+
+        // Takes effect from the token after `peek()`
         void set_diag_emitter(diag::DiagEmitter& diag_emitter);
 
         void set_tok_emitter(TokEmitter& tok_emitter);
@@ -35,7 +150,49 @@ namespace alvo::lex {
 
         tok::Tok peek() const;
 
+        // Returns the character `n` after the current one without advancing,
+        // the current one for `n == 0`, or the sentinel 0 past the end of the
+        // valid prefix
+        utf8::Codepoint peek_ch(std::size_t n = 1) const;
+
+        // Lexes every remaining token up to and including `Eof`, only the
+        // tokens before `Eof` go to the token emitter
+        TokenBuffer tokenize_all();
+
+        // Lexes all of `source` like `tokenize_all()`, split into at most
+        // `chunk_count` chunks that are handed out to at most one thread per
+        // hardware thread, the calling one included. Chunks start right after
+        // a newline, where no token, string or comment can be open, so
+        // tokens, symbol ids and diagnostics come out the same as from
+        // sequential lexing. Diagnostics are emitted once all chunks are
+        // lexed.
+        static TokenBuffer tokenize_parallel(const source::SourceFile& source,
+            sym::SymbolTable& symbols, mem::Arena& literal_arena,
+            std::size_t chunk_count, diag::DiagEmitter* diag_emitter = nullptr);
+
+        // Updates `tokens` in place to the tokens of `source`, which is the
+        // source of `tokens` with `edit` applied, keeping those `edit` can't
+        // change. Relexing starts on the line of the edit and stops at the
+        // first token after it that starts where an old one did, so the cost
+        // is that of the relexed tokens plus those between this edit and the
+        // previous one. `symbols` must be the table `tokens` was lexed with,
+        // only relexed diagnostics are emitted. Decoded strings are kept in
+        // an arena of `tokens`, so replaced ones can be reclaimed.
+        static void relex(TokenBuffer& tokens,
+            const source::SourceFile& source, const Edit& edit,
+            sym::SymbolTable& symbols,
+            diag::DiagEmitter* diag_emitter = nullptr);
+
     private:
+        // Lexes `[begin, end)` of `source`, of which everything before
+        // `valid_end` is valid UTF-8, with offsets relative to `begin`.
+        // Identifiers are only interned when `symbols` isn't null.
+        Lexer(const source::SourceFile& source, std::size_t begin,
+            std::size_t end, std::size_t valid_end, sym::SymbolTable* symbols,
+            mem::Arena* literal_arena, diag::DiagEmitter* diag_emitter);
+
+        void lex_into(TokenBuffer& res);
+
         tok::Tok get_token();
 
         tok::Tok lex_string();
@@ -46,12 +203,28 @@ namespace alvo::lex {
 
         tok::Tok lex_sym();
 
+        // Decode the current number or quoted literal into a token of
+        // `kind` or report why it has no value
+        tok::Tok decode_num(tok::TokKind kind, int base);
+
+        tok::Tok decode_quoted(bool is_char);
+
         void advance();
 
+        // Whether `m_ch` is past the valid prefix rather than a NUL in it
+        bool at_end() const;
+
+        // Moves to the character at byte `offset` of the valid prefix, which
+        // must start a codepoint
+        void skip_to(std::size_t offset);
+
         void recover();
 
         tok::Tok create_err_and_emit(diag::Err err);
 
+        // Reports `err` at `pos` instead of the current position
+        tok::Tok create_err_and_emit(diag::Err err, tok::Pos pos);
+
         tok::Tok create_tok(tok::TokKind kind) const;
 
         tok::Tok create_tok(tok::TokKind kind, std::string_view view) const;
@@ -59,23 +232,18 @@ namespace alvo::lex {
         std::string_view get_curr_value() const;
 
         std::string_view m_src;
+        // Length of the valid UTF-8 prefix of `m_src`, lexing stops there
+        std::size_t m_valid_size;
         utf8::Utf8Iter m_src_iter;
         tok::Pos m_pos;
         tok::Pos m_pos_next;
         tok::Pos m_pos_begin;
         tok::Tok m_curr;
         utf8::Codepoint m_ch;
-        bool m_eof;
+        bool m_invalid_utf8_reported;
+        sym::SymbolTable* m_symbols;
+        mem::Arena* m_literal_arena;
         diag::DiagEmitter* m_diag_emitter;
         TokEmitter* m_tok_emitter;
     };
-
-    static_assert(std::is_trivially_copyable_v<Lexer>,
-        "Lexer must remain trivially copyable for cheap state save/restore.");
-
-    static_assert(std::is_trivially_destructible_v<Lexer>,
-        "Lexer must not manage non-trivial resources.");
-
-    static_assert(std::is_trivially_copy_assignable_v<Lexer>,
-        "Lexer must remain cheap to assign (used in backtracking).");
 }
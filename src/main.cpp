@@ -1,9 +1,11 @@
+#include <algorithm>
 #include <iostream>
-#include <fstream>
-#include <optional>
+#include <memory_resource>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -13,6 +15,8 @@
 #include "parse.h"
 #include "ast.h"
 #include "mem.h"
+#include "source.h"
+#include "sym.h"
 #include "util.h"
 #include "args.h"
 
@@ -25,12 +29,15 @@ public:
             indent(0) { }
     };
 
-    Handler(State& state, std::string_view file_path) :
+    Handler(State& state, std::string_view file_path,
+        const alvo::source::SourceFile& source) :
         m_state(&state),
-        m_file_path(file_path) { };
+        m_file_path(file_path),
+        m_source(&source) { };
 
-    void operator()([[maybe_unused]] const alvo::diag::Diag& diag) {
-        fmt::print(std::cerr, "{}:{}: ", m_file_path, diag.pos);
+    void operator()(const alvo::diag::Diag& diag) {
+        fmt::print(
+            std::cerr, "{}:{}: ", m_file_path, m_source->line_col(diag.pos));
         std::visit(
             alvo::util::overload { [](const alvo::diag::Warn& warn) {
                                       using alvo::diag::Warn;
@@ -79,6 +86,30 @@ public:
                                 fmt::print(std::cerr,
                                     "unexpected character in number literal");
                             },
+                            [](const Err::InvalidUtf8&) {
+                                fmt::print(std::cerr, "invalid UTF-8");
+                            },
+                            [](const Err::IntegerLiteralTooLarge&) {
+                                fmt::print(std::cerr,
+                                    "integer literal does not fit in 64 bits");
+                            },
+                            [](const Err::ByteLiteralTooLarge&) {
+                                fmt::print(std::cerr,
+                                    "byte literal is larger than 255");
+                            },
+                            [](const Err::FloatingPointLiteralOutOfRange&) {
+                                fmt::print(std::cerr,
+                                    "floating point literal is out of range");
+                            },
+                            [](const Err::UnknownEscapeSequence&) {
+                                fmt::print(
+                                    std::cerr, "unknown escape sequence");
+                            },
+                            [](const Err::InvalidCharacterLiteralLength&) {
+                                fmt::print(std::cerr,
+                                    "character literal must hold exactly one "
+                                    "character");
+                            },
                             [](const Err::UnexpectedToken& v) {
                                 fmt::print(std::cerr,
                                     "unexpected token `{}`", v.tok.value);
@@ -93,7 +124,8 @@ public:
 
     void operator()(const alvo::tok::Tok& tok) {
         indent();
-        fmt::println("Tok: {}", tok);
+        fmt::println("Tok: {}:{}: {}(`{}`)", m_source->line_col(tok.loc.s),
+            m_source->line_col(tok.loc.e), tok.kind, tok.value);
     }
 
     void operator()(alvo::parse::SectionEvent event) {
@@ -120,40 +152,71 @@ private:
 
     State* m_state;
     std::string_view m_file_path;
+    const alvo::source::SourceFile* m_source;
 };
 
-std::optional<std::string> read_file(std::string_view path) {
-    std::ifstream file(path.data());
-    if (!file.is_open()) {
+void print_load_error(std::string_view path, alvo::source::LoadError err) {
+    switch (err) {
+    case alvo::source::LoadError::Open:
         fmt::println(std::cerr, "error: failed to open file `{}`", path);
-        return std::nullopt;
-    }
-    file.seekg(0, std::ios::end);
-    if (file.fail()) {
+        break;
+    case alvo::source::LoadError::Read:
         fmt::println(std::cerr, "error: failed to read file `{}`", path);
-        return std::nullopt;
+        break;
+    case alvo::source::LoadError::TooLarge:
+        fmt::println(std::cerr, "error: file `{}` is larger than 4 GiB", path);
+        break;
     }
-    std::size_t file_size = file.tellg();
-    file.seekg(0, std::ios::beg);
-    if (file.fail()) {
-        fmt::println(std::cerr, "error: failed to read file `{}`", path);
-        return std::nullopt;
+}
+
+void print_alloc_stats(const alvo::ast::util::AllocStats& stats) {
+    using alvo::ast::util::AllocStat;
+    using alvo::ast::util::NODE_KIND_NAMES;
+
+    struct Row {
+        std::string name;
+        AllocStat stat;
+    };
+
+    std::vector<Row> rows;
+    const auto& nodes = stats.get_nodes();
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].count > 0) {
+            rows.push_back({ std::string(NODE_KIND_NAMES[i]), nodes[i] });
+        }
     }
-    std::string data;
-    data.resize(file_size, '\0');
-    file.read(data.data(), file_size);
-    if (file.fail()) {
-        fmt::println(std::cerr, "error: failed to read file `{}`", path);
-        return std::nullopt;
+    const auto& list_nodes = stats.get_list_nodes();
+    for (std::size_t i = 0; i < list_nodes.size(); i++) {
+        if (list_nodes[i].count > 0) {
+            rows.push_back(
+                { fmt::format("List<{}>", NODE_KIND_NAMES[i]), list_nodes[i] });
+        }
     }
-    return data;
-}
+    std::sort(rows.begin(), rows.end(), [](const Row& lhs, const Row& rhs) {
+        return lhs.stat.bytes > rhs.stat.bytes;
+    });
 
-void eat_all_tokens(alvo::lex::Lexer& lexer) {
-    while (!lexer.next().is_eof())
-        ;
+    AllocStat total = stats.get_total();
+    fmt::println("{:<40} {:>12} {:>14} {:>7}", "Node kind", "Count", "Bytes",
+        "Share");
+    for (const Row& row : rows) {
+        double share = total.bytes == 0
+                           ? 0.0
+                           : 100.0 * (double)row.stat.bytes / total.bytes;
+        fmt::println("{:<40} {:>12} {:>14} {:>6.2f}%", row.name,
+            fmt::group_digits(row.stat.count),
+            fmt::group_digits(row.stat.bytes), share);
+    }
+    fmt::println("{:<40} {:>12} {:>14}", "Total",
+        fmt::group_digits(total.count), fmt::group_digits(total.bytes));
 }
 
+// Sources are only split for parallel lexing into chunks at least this big
+constexpr std::size_t LEX_CHUNK_SIZE = 1024 * 1024;
+
+// Block size of the arena holding scratch storage of the driver
+constexpr std::size_t SCRATCH_ARENA_BLOCK_SIZE = 4096;
+
 int main(int argc, char** argv) {
     using alvo::args::Args;
     using alvo::args::ArgsResult;
@@ -167,31 +230,63 @@ int main(int argc, char** argv) {
         }
     }
 
-    std::optional<std::string> source = read_file(args->file);
+    alvo::source::LoadResult source =
+        alvo::source::SourceFile::load(args->file.data());
     if (!source) {
+        print_load_error(args->file, source.error());
         return 1;
     }
 
     Handler::State handler_state;
-    Handler handler(handler_state, args->file);
-    alvo::diag::DiagEmitter diag_emitter(handler);
-    alvo::lex::TokEmitter tok_emitter(handler);
+    Handler handler(handler_state, args->file, *source);
+    // The whole source is lexed before parsing starts, so diagnostics are
+    // held back in scratch storage and printed in source order once parsing
+    // is done
+    alvo::mem::Arena scratch_arena(SCRATCH_ARENA_BLOCK_SIZE);
+    alvo::mem::ArenaResource scratch_resource(scratch_arena);
+    std::pmr::vector<alvo::diag::Diag> diags(&scratch_resource);
+    auto collect_diag = [&](const alvo::diag::Diag& diag) {
+        diags.push_back(diag);
+    };
+    alvo::diag::DiagEmitter diag_emitter(collect_diag);
     alvo::parse::SectionEmitter enter_emitter(handler);
 
-    alvo::lex::Lexer lexer(*source);
-    lexer.set_diag_emitter(diag_emitter);
+    alvo::mem::Arena symbol_arena(4096);
+    alvo::sym::SymbolTable symbols(symbol_arena);
+    alvo::mem::Arena literal_arena(4096);
+    std::size_t chunk_count = std::clamp<std::size_t>(
+        source->get_src().size() / LEX_CHUNK_SIZE, 1,
+        std::max(std::thread::hardware_concurrency(), 1u));
+    alvo::lex::TokenBuffer tokens = alvo::lex::Lexer::tokenize_parallel(
+        *source, symbols, literal_arena, chunk_count, &diag_emitter);
     if (args->emit_tokens) {
-        lexer.set_tok_emitter(tok_emitter);
+        // The trailing `Eof` is the end marker of the buffer, not a token
+        // the parser consumes
+        for (std::size_t i = 0; i + 1 < tokens.size(); i++) {
+            handler(tokens.get(i));
+        }
     }
 
-    alvo::mem::Arena node_arena(8192);
-    alvo::parse::Parser parser(lexer, node_arena);
+    alvo::mem::Arena node_arena(8192, alvo::mem::ArenaBackend::Reserved);
+    alvo::ast::util::AllocStats alloc_stats;
+    alvo::parse::Parser parser(tokens, node_arena);
     parser.set_diag_emitter(diag_emitter);
+    if (args->show_allocs) {
+        parser.set_alloc_stats(alloc_stats);
+    }
     if (args->emit_sections) {
         parser.set_section_emitter(enter_emitter);
     }
 
     alvo::ast::Module module = parser.parse_module();
+    std::stable_sort(diags.begin(), diags.end(),
+        [](const alvo::diag::Diag& lhs, const alvo::diag::Diag& rhs) {
+            return lhs.pos.offset < rhs.pos.offset;
+        });
+    for (const alvo::diag::Diag& diag : diags) {
+        handler(diag);
+    }
+
     if (args->print_ast) {
         alvo::ast::print::OstreamSink sink(std::cout);
         alvo::ast::Printer printer(sink, 1);
@@ -205,6 +300,7 @@ int main(int argc, char** argv) {
                 Style::fg_color(Color { 0, 0, 255 }) | Style::italic(),
             .string = Style::fg_color(Color { 255, 127, 0 }),
             .boolean = Style::fg_color(Color { 255, 255, 0 }) | Style::bold(),
+            .number = Style::fg_color(Color { 0, 191, 255 }),
         });
         printer.print_node(module);
         fmt::print("\n");
@@ -217,6 +313,7 @@ int main(int argc, char** argv) {
         fmt::println("Arena allocated: {} B", fmt::group_digits(alloced));
         fmt::println("Arena block count: {}", fmt::group_digits(block_count));
         fmt::println("Used for AST: {} B", fmt::group_digits(used));
+        print_alloc_stats(alloc_stats);
     }
 
     return 0;
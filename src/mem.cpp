@@ -1,6 +1,19 @@
 #include "mem.h"
 
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
 #include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  define ALVO_MMAP 1
+#else
+#  define ALVO_MMAP 0
+#endif
 
 namespace alvo::mem {
 
@@ -12,17 +25,79 @@ namespace alvo::mem {
         return x != 0 && (x & (x - 1)) == 0;
     }
 
+    // Smaller blocks come from `calloc`, a mapping of their own would cost
+    // a syscall and a whole page each
+    static constexpr std::size_t MAP_BLOCK_THRESHOLD = 64 * 1024;
+
+    static bool _is_mapped_block(std::size_t size) {
+        return ALVO_MMAP && size >= MAP_BLOCK_THRESHOLD;
+    }
+
+    static char* _map_block(std::size_t size) {
+        if (size == 0) {
+            return nullptr;
+        }
+#if ALVO_MMAP
+        if (_is_mapped_block(size)) {
+            void* res = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (res == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            return static_cast<char*>(res);
+        }
+#endif
+        void* res = std::calloc(size, 1);
+        if (res == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<char*>(res);
+    }
+
+    static void _unmap_block(char* data, std::size_t size) {
+        if (data == nullptr) {
+            return;
+        }
+#if ALVO_MMAP
+        if (_is_mapped_block(size)) {
+            munmap(data, size);
+            return;
+        }
+#endif
+        std::free(data);
+    }
+
     ArenaBlock::ArenaBlock(std::size_t size) :
-        m_data(new char[size]),
+        m_data(_map_block(size)),
         m_size(size),
-        m_used(0) {
-        std::memset(m_data.get(), 0, size);
+        m_used(0),
+        m_dirty(0) { }
+
+    ArenaBlock::ArenaBlock(ArenaBlock&& other) noexcept :
+        m_data(std::exchange(other.m_data, nullptr)),
+        m_size(std::exchange(other.m_size, 0)),
+        m_used(std::exchange(other.m_used, 0)),
+        m_dirty(std::exchange(other.m_dirty, 0)) { }
+
+    ArenaBlock& ArenaBlock::operator=(ArenaBlock&& other) noexcept {
+        if (this != &other) {
+            _unmap_block(m_data, m_size);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_used = std::exchange(other.m_used, 0);
+            m_dirty = std::exchange(other.m_dirty, 0);
+        }
+        return *this;
     }
 
+    ArenaBlock::~ArenaBlock() { _unmap_block(m_data, m_size); }
+
     std::size_t ArenaBlock::size() const { return m_size; }
 
     std::size_t ArenaBlock::used() const { return m_used; }
 
+    std::size_t ArenaBlock::dirty() const { return m_dirty; }
+
     bool ArenaBlock::can_fit(std::size_t size, std::size_t alignment) const {
         if (!_is_power_of_two(alignment)) {
             return false;
@@ -31,7 +106,8 @@ namespace alvo::mem {
         return used + size <= m_size;
     }
 
-    void* ArenaBlock::alloc(std::size_t size, std::size_t alignment) {
+    void* ArenaBlock::alloc(
+        std::size_t size, std::size_t alignment, bool zeroed) {
         if (size == 0) {
             return nullptr;
         }
@@ -42,17 +118,244 @@ namespace alvo::mem {
         if (m_used + size > m_size) {
             return nullptr;
         }
-        char* res = m_data.get() + m_used;
+        char* res = m_data + m_used;
+        // Only memory below the high-water mark may have been written to
+        if (zeroed && m_used < m_dirty) {
+            std::memset(res, 0, std::min(size, m_dirty - m_used));
+        }
         m_used += size;
+        m_dirty = std::max(m_dirty, m_used);
+        return res;
+    }
+
+    void ArenaBlock::rewind(std::size_t used) {
+        if (used >= m_used) {
+            return;
+        }
+        m_used = used;
+    }
+
+    void ArenaBlock::discard() {
+        m_used = 0;
+        if (m_dirty == 0) {
+            return;
+        }
+#if ALVO_MMAP
+        if (_is_mapped_block(m_size)) {
+            madvise(m_data, m_size, MADV_DONTNEED);
+            m_dirty = 0;
+            return;
+        }
+#endif
+        std::memset(m_data, 0, m_dirty);
+        m_dirty = 0;
+    }
+
+    bool ArenaBlock::contains(const void* ptr) const {
+        const char* p = static_cast<const char*>(ptr);
+        return m_data != nullptr && m_data <= p && p < m_data + m_size;
+    }
+
+    BlockPool::BlockPool(
+        std::size_t max_pooled_bytes, bool discard_on_release) :
+        m_blocks(),
+        m_max_pooled_bytes(max_pooled_bytes),
+        m_pooled_bytes(0),
+        m_discard_on_release(discard_on_release) { }
+
+    ArenaBlock BlockPool::acquire(std::size_t size) {
+        // Best fit, the pool is expected to hold few distinct sizes
+        auto best = m_blocks.end();
+        for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it) {
+            if (it->size() >= size &&
+                (best == m_blocks.end() || it->size() < best->size())) {
+                best = it;
+            }
+        }
+        if (best == m_blocks.end()) {
+            return ArenaBlock(size);
+        }
+        ArenaBlock res = std::move(*best);
+        *best = std::move(m_blocks.back());
+        m_blocks.pop_back();
+        m_pooled_bytes -= res.size();
+        return res;
+    }
+
+    void BlockPool::release(ArenaBlock&& block) {
+        if (block.size() == 0 ||
+            m_pooled_bytes + block.size() > m_max_pooled_bytes) {
+            ArenaBlock freed = std::move(block);
+            return;
+        }
+        if (m_discard_on_release) {
+            block.discard();
+        } else {
+            block.rewind(0);
+        }
+        m_pooled_bytes += block.size();
+        m_blocks.push_back(std::move(block));
+    }
+
+    std::size_t BlockPool::get_pooled_bytes() const { return m_pooled_bytes; }
+
+    std::size_t BlockPool::get_block_count() const { return m_blocks.size(); }
+
+    static std::size_t _page_size() {
+#if ALVO_MMAP
+        return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+        return 4096;
+#endif
+    }
+
+    static char* _reserve_region(std::size_t size) {
+#if ALVO_MMAP
+        if (size == 0) {
+            return nullptr;
+        }
+        void* res = mmap(nullptr, size, PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (res == MAP_FAILED) {
+            return nullptr;
+        }
+        return static_cast<char*>(res);
+#else
+        (void)size;
+        return nullptr;
+#endif
+    }
+
+    static void _release_region(char* data, std::size_t size) {
+#if ALVO_MMAP
+        if (data != nullptr) {
+            munmap(data, size);
+        }
+#else
+        (void)data;
+        (void)size;
+#endif
+    }
+
+    ArenaRegion::ArenaRegion(
+        std::size_t reserve_size, std::size_t commit_granularity) :
+        m_data(nullptr),
+        m_size(0),
+        m_committed(0),
+        m_used(0),
+        m_dirty(0),
+        m_commit_granularity(std::bit_ceil(
+            std::max(commit_granularity, _page_size()))) {
+        reserve_size = _align_up(reserve_size, m_commit_granularity);
+        m_data = _reserve_region(reserve_size);
+        if (m_data != nullptr) {
+            m_size = reserve_size;
+        }
+    }
+
+    ArenaRegion::ArenaRegion(ArenaRegion&& other) noexcept :
+        m_data(std::exchange(other.m_data, nullptr)),
+        m_size(std::exchange(other.m_size, 0)),
+        m_committed(std::exchange(other.m_committed, 0)),
+        m_used(std::exchange(other.m_used, 0)),
+        m_dirty(std::exchange(other.m_dirty, 0)),
+        m_commit_granularity(other.m_commit_granularity) { }
+
+    ArenaRegion& ArenaRegion::operator=(ArenaRegion&& other) noexcept {
+        if (this != &other) {
+            _release_region(m_data, m_size);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_committed = std::exchange(other.m_committed, 0);
+            m_used = std::exchange(other.m_used, 0);
+            m_dirty = std::exchange(other.m_dirty, 0);
+            m_commit_granularity = other.m_commit_granularity;
+        }
+        return *this;
+    }
+
+    ArenaRegion::~ArenaRegion() { _release_region(m_data, m_size); }
+
+    bool ArenaRegion::reserved() const { return m_data != nullptr; }
+
+    std::size_t ArenaRegion::size() const { return m_size; }
+
+    std::size_t ArenaRegion::committed() const { return m_committed; }
+
+    std::size_t ArenaRegion::used() const { return m_used; }
+
+    void* ArenaRegion::alloc(
+        std::size_t size, std::size_t alignment, bool zeroed) {
+        if (size == 0) {
+            return nullptr;
+        }
+        if (!_is_power_of_two(alignment)) {
+            return nullptr;
+        }
+        std::size_t used = _align_up(m_used, alignment);
+        if (used + size > m_committed && !commit(used + size)) {
+            return nullptr;
+        }
+        char* res = m_data + used;
+        // Only memory below the high-water mark may have been written to
+        if (zeroed && used < m_dirty) {
+            std::memset(res, 0, std::min(size, m_dirty - used));
+        }
+        m_used = used + size;
+        m_dirty = std::max(m_dirty, m_used);
         return res;
     }
 
-    Arena::Arena(std::size_t block_size) :
+    void ArenaRegion::rewind(std::size_t used) {
+        if (used >= m_used) {
+            return;
+        }
+        m_used = used;
+    }
+
+    bool ArenaRegion::contains(const void* ptr) const {
+        const char* p = static_cast<const char*>(ptr);
+        return m_data != nullptr && m_data <= p && p < m_data + m_committed;
+    }
+
+    bool ArenaRegion::commit(std::size_t size) {
+#if ALVO_MMAP
+        if (size > m_size) {
+            return false;
+        }
+        std::size_t committed =
+            std::min(_align_up(size, m_commit_granularity), m_size);
+        if (mprotect(m_data + m_committed, committed - m_committed,
+                PROT_READ | PROT_WRITE) != 0) {
+            return false;
+        }
+        m_committed = committed;
+        return true;
+#else
+        (void)size;
+        return false;
+#endif
+    }
+
+    Arena::Arena(std::size_t block_size, ArenaBackend backend,
+        std::size_t reserve_size) :
+        m_region(backend == ArenaBackend::Reserved ? reserve_size : 0,
+            block_size),
         m_blocks(),
         m_block_size(block_size),
-        m_total_allocated(0) { }
+        m_total_allocated(0),
+        m_total_used_prev(0),
+        m_pool(nullptr),
+        m_dtors(nullptr) { }
+
+    Arena::~Arena() { reset(); }
+
+    void Arena::set_block_pool(BlockPool& pool) { m_pool = &pool; }
 
-    void* Arena::alloc(std::size_t size, std::size_t alignment) {
+    void* Arena::alloc(std::size_t size, std::size_t alignment, bool zeroed) {
+        if (m_region.reserved()) {
+            return m_region.alloc(size, alignment, zeroed);
+        }
         if (size == 0) {
             return nullptr;
         }
@@ -60,8 +363,7 @@ namespace alvo::mem {
             return nullptr;
         }
         if (m_blocks.size() == 0) {
-            m_blocks.emplace_back(m_block_size);
-            m_total_allocated += m_block_size;
+            push_block(m_block_size);
         }
         if (!m_blocks.back().can_fit(size, alignment)) {
             std::size_t new_block_size = m_block_size;
@@ -72,22 +374,206 @@ namespace alvo::mem {
                     new_block_size *= 2;
                 }
             }
-            m_blocks.emplace_back(new_block_size);
-            m_total_allocated += new_block_size;
+            push_block(new_block_size);
         }
-        return m_blocks.back().alloc(size, alignment);
+        return m_blocks.back().alloc(size, alignment, zeroed);
     }
 
-    std::size_t Arena::get_total_allocated() const { return m_total_allocated; }
+    Arena::Mark Arena::mark() const {
+        if (m_region.reserved()) {
+            return Mark { 0, m_region.used(), m_dtors };
+        }
+        if (m_blocks.size() == 0) {
+            return Mark { 0, 0, m_dtors };
+        }
+        return Mark { m_blocks.size(), m_blocks.back().used(), m_dtors };
+    }
 
-    std::size_t Arena::get_total_used() const {
-        std::size_t used = 0;
+    void Arena::rewind(Mark mark) {
+        if (m_region.reserved()) {
+            run_dtors(mark.dtors);
+            m_region.rewind(mark.block_used);
+            return;
+        }
+        if (mark.block_count > m_blocks.size()) {
+            return;
+        }
+        run_dtors(mark.dtors);
+        while (m_blocks.size() > mark.block_count) {
+            pop_block();
+        }
+        if (m_blocks.size() > 0) {
+            m_blocks.back().rewind(mark.block_used);
+        }
+    }
+
+    void Arena::reset() {
+        run_dtors(nullptr);
+        if (m_region.reserved()) {
+            m_region.rewind(0);
+            return;
+        }
+        while (m_blocks.size() > 0) {
+            pop_block();
+        }
+    }
+
+    bool Arena::adopt(Arena& other) {
+        if (m_region.reserved() || other.m_region.reserved()) {
+            return false;
+        }
+        if (&other == this || other.m_blocks.size() == 0) {
+            return true;
+        }
+
+        // Appending keeps marks taken on this arena meaningful: rewinding
+        // to one releases the adopted blocks as well
+        if (m_blocks.size() > 0) {
+            m_total_used_prev += m_blocks.back().used();
+        }
+        m_total_used_prev += other.m_total_used_prev;
+        m_total_allocated += other.m_total_allocated;
+        for (auto& block : other.m_blocks) {
+            m_blocks.push_back(std::move(block));
+        }
+        other.m_blocks.clear();
+        other.m_total_allocated = 0;
+        other.m_total_used_prev = 0;
+
+        if (other.m_dtors) {
+            DtorRecord* oldest = other.m_dtors;
+            while (oldest->prev) {
+                oldest = oldest->prev;
+            }
+            oldest->prev = m_dtors;
+            m_dtors = other.m_dtors;
+            other.m_dtors = nullptr;
+        }
+        return true;
+    }
+
+    bool Arena::contains(const void* ptr) const {
+        if (m_region.reserved()) {
+            return m_region.contains(ptr);
+        }
         for (const auto& block : m_blocks) {
-            used += block.used();
+            if (block.contains(ptr)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ArenaBackend Arena::get_backend() const {
+        if (m_region.reserved()) {
+            return ArenaBackend::Reserved;
+        }
+        return ArenaBackend::Blocks;
+    }
+
+    std::size_t Arena::get_total_allocated() const {
+        if (m_region.reserved()) {
+            return m_region.committed();
+        }
+        return m_total_allocated;
+    }
+
+    std::size_t Arena::get_total_used() const {
+        if (m_region.reserved()) {
+            return m_region.used();
+        }
+        if (m_blocks.size() == 0) {
+            return 0;
+        }
+        return m_total_used_prev + m_blocks.back().used();
+    }
+
+    std::size_t Arena::get_block_count() const {
+        if (m_region.reserved()) {
+            return m_region.committed() > 0 ? 1 : 0;
+        }
+        return m_blocks.size();
+    }
+
+    void Arena::push_block(std::size_t size) {
+        if (m_blocks.size() > 0) {
+            m_total_used_prev += m_blocks.back().used();
+        }
+        if (m_pool) {
+            m_blocks.push_back(m_pool->acquire(size));
+        } else {
+            m_blocks.emplace_back(size);
+        }
+        m_total_allocated += m_blocks.back().size();
+    }
+
+    void Arena::pop_block() {
+        m_total_allocated -= m_blocks.back().size();
+        if (m_pool) {
+            m_pool->release(std::move(m_blocks.back()));
+        }
+        m_blocks.pop_back();
+        if (m_blocks.size() > 0) {
+            m_total_used_prev -= m_blocks.back().used();
         }
-        return used;
     }
 
-    std::size_t Arena::get_block_count() const { return m_blocks.size(); }
+    void Arena::run_dtors(DtorRecord* until) {
+        while (m_dtors != until && m_dtors != nullptr) {
+            DtorRecord* rec = m_dtors;
+            m_dtors = rec->prev;
+            rec->destroy(rec->obj);
+        }
+    }
+
+    ArenaGroup::ArenaGroup(std::size_t block_size) :
+        m_block_size(block_size),
+        m_mutex(),
+        m_arenas(),
+        m_arena(block_size) { }
+
+    Arena& ArenaGroup::create_arena() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_arenas.emplace_back(m_block_size);
+    }
+
+    Arena& ArenaGroup::merge() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (Arena& arena : m_arenas) {
+            m_arena.adopt(arena);
+        }
+        m_arenas.clear();
+        return m_arena;
+    }
+
+    Arena& ArenaGroup::get_arena() { return m_arena; }
+
+    std::size_t ArenaGroup::get_arena_count() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_arenas.size();
+    }
+
+    ArenaResource::ArenaResource(Arena& arena) :
+        m_arena(&arena) { }
+
+    Arena& ArenaResource::get_arena() const { return *m_arena; }
+
+    void* ArenaResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+        // Zero-sized requests must still yield a unique pointer
+        void* res = m_arena->alloc(std::max(bytes, std::size_t(1)), alignment);
+        if (res == nullptr) {
+            throw std::bad_alloc();
+        }
+        return res;
+    }
+
+    void ArenaResource::do_deallocate([[maybe_unused]] void* ptr,
+        [[maybe_unused]] std::size_t bytes,
+        [[maybe_unused]] std::size_t alignment) { }
+
+    bool ArenaResource::do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
 
 }
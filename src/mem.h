@@ -1,27 +1,145 @@
 #pragma once
 
 #include <cstddef>
-#include <memory>
+#include <deque>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace alvo::mem {
 
+    // Block of memory backing an `Arena`.
+    //
+    // Blocks are not zero-filled up front: on POSIX systems large blocks are
+    // mapped with anonymous `mmap`, so untouched pages are zero pages provided
+    // by the OS, and small ones come from `calloc`. Memory below the
+    // high-water mark (`dirty()`) may hold stale data after a `rewind()`, so
+    // callers that need zeroed memory must ask for it explicitly.
     class ArenaBlock {
     public:
         ArenaBlock(std::size_t size);
 
+        ArenaBlock(const ArenaBlock&) = delete;
+
+        ArenaBlock(ArenaBlock&& other) noexcept;
+
+        ArenaBlock& operator=(const ArenaBlock&) = delete;
+
+        ArenaBlock& operator=(ArenaBlock&& other) noexcept;
+
+        ~ArenaBlock();
+
         std::size_t size() const;
 
         std::size_t used() const;
 
+        std::size_t dirty() const;
+
         bool can_fit(std::size_t size, std::size_t alignment) const;
 
-        void* alloc(std::size_t size, std::size_t alignment);
+        void* alloc(
+            std::size_t size, std::size_t alignment, bool zeroed = false);
+
+        void rewind(std::size_t used);
+
+        // Returns the pages to the OS, the block reads as zero afterwards
+        void discard();
+
+        bool contains(const void* ptr) const;
+
+    private:
+        char* m_data;
+        std::size_t m_size;
+        std::size_t m_used;
+        std::size_t m_dirty;
+    };
+
+    // Pool of free blocks shared between arenas.
+    //
+    // Arenas using a pool take their blocks from it and hand them back on
+    // `reset()`, `rewind()` and destruction instead of freeing them. Blocks
+    // are kept as long as the pooled bytes stay below `max_pooled_bytes`,
+    // anything above that is freed. The pool is not synchronized.
+    class BlockPool {
+    public:
+        BlockPool(
+            std::size_t max_pooled_bytes, bool discard_on_release = false);
+
+        BlockPool(const BlockPool&) = delete;
+
+        BlockPool& operator=(const BlockPool&) = delete;
+
+        // Returns a pooled block of at least `size` bytes or a new one
+        ArenaBlock acquire(std::size_t size);
+
+        void release(ArenaBlock&& block);
+
+        std::size_t get_pooled_bytes() const;
+
+        std::size_t get_block_count() const;
+
+    private:
+        std::vector<ArenaBlock> m_blocks;
+        std::size_t m_max_pooled_bytes;
+        std::size_t m_pooled_bytes;
+        bool m_discard_on_release;
+    };
+
+    // Contiguous virtual memory range backing an `Arena`.
+    //
+    // The whole range is reserved once with no access rights and pages are
+    // committed in `commit_granularity` steps as the bump pointer moves, so
+    // everything allocated from it lives in a single region. `reserved()` is
+    // false if the platform does not support it or the reservation failed.
+    class ArenaRegion {
+    public:
+        ArenaRegion(std::size_t reserve_size, std::size_t commit_granularity);
+
+        ArenaRegion(const ArenaRegion&) = delete;
+
+        ArenaRegion(ArenaRegion&& other) noexcept;
+
+        ArenaRegion& operator=(const ArenaRegion&) = delete;
+
+        ArenaRegion& operator=(ArenaRegion&& other) noexcept;
+
+        ~ArenaRegion();
+
+        bool reserved() const;
+
+        std::size_t size() const;
+
+        std::size_t committed() const;
+
+        std::size_t used() const;
+
+        void* alloc(
+            std::size_t size, std::size_t alignment, bool zeroed = false);
+
+        void rewind(std::size_t used);
+
+        bool contains(const void* ptr) const;
 
     private:
-        std::unique_ptr<char[]> m_data;
+        bool commit(std::size_t size);
+
+        char* m_data;
         std::size_t m_size;
+        std::size_t m_committed;
         std::size_t m_used;
+        std::size_t m_dirty;
+        std::size_t m_commit_granularity;
+    };
+
+    enum class ArenaBackend {
+        // Growable list of separately allocated blocks
+        Blocks,
+        // Single reserved virtual memory range, falls back to `Blocks` if
+        // the range can not be reserved
+        Reserved,
     };
 
     template<typename T>
@@ -31,9 +149,102 @@ namespace alvo::mem {
 
     class Arena {
     public:
-        Arena(std::size_t block_size);
+        // Pending destructor of an object made with `make()`, allocated in
+        // the arena right after the object it destroys
+        struct DtorRecord {
+            void (*destroy)(void*);
+            void* obj;
+            DtorRecord* prev;
+        };
+
+        // Checkpoint of the arena state, see `mark()` and `rewind()`
+        struct Mark {
+            std::size_t block_count;
+            std::size_t block_used;
+            DtorRecord* dtors;
+        };
+
+        // 64 GiB
+        static constexpr std::size_t DEFAULT_RESERVE_SIZE = 64ull << 30;
+
+        // With `ArenaBackend::Reserved`, `block_size` is the commit
+        // granularity of the reserved range.
+        Arena(std::size_t block_size,
+            ArenaBackend backend = ArenaBackend::Blocks,
+            std::size_t reserve_size = DEFAULT_RESERVE_SIZE);
+
+        Arena(const Arena&) = delete;
+
+        Arena& operator=(const Arena&) = delete;
+
+        ~Arena();
+
+        // Must be set before the first allocation, the pool must outlive
+        // the arena
+        void set_block_pool(BlockPool& pool);
+
+        // Returns memory with unspecified contents unless `zeroed` is set.
+        void* alloc(
+            std::size_t size, std::size_t alignment, bool zeroed = false);
 
-        void* alloc(std::size_t size, std::size_t alignment);
+        // Constructs a `T` in the arena. If `T` is not trivially
+        // destructible its destructor is registered and run when the object
+        // is released by `rewind()`, `reset()` or the arena destructor, in
+        // reverse order of construction.
+        template<typename T, typename... Args>
+        T* make(Args&&... args) {
+            void* ptr = alloc(sizeof(T), alignof(T));
+            if (ptr == nullptr) {
+                return nullptr;
+            }
+            if constexpr (std::is_trivially_destructible_v<T>) {
+                return new (ptr) T(std::forward<Args>(args)...);
+            } else {
+                void* rec = alloc(sizeof(DtorRecord), alignof(DtorRecord));
+                if (rec == nullptr) {
+                    return nullptr;
+                }
+                T* obj = new (ptr) T(std::forward<Args>(args)...);
+                m_dtors = new (rec) DtorRecord { &destroy<T>, obj, m_dtors };
+                return obj;
+            }
+        }
+
+        // Registers the destructor of `obj`, constructed in memory from
+        // `alloc()`, as `make()` does. Lets the slot of an object be taken
+        // before its constructor arguments are built.
+        template<typename T>
+        bool own(T* obj) {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                void* rec = alloc(sizeof(DtorRecord), alignof(DtorRecord));
+                if (rec == nullptr) {
+                    return false;
+                }
+                m_dtors = new (rec) DtorRecord { &destroy<T>, obj, m_dtors };
+            }
+            return true;
+        }
+
+        Mark mark() const;
+
+        // Releases everything allocated after `mark` was taken, including
+        // whole trailing blocks. Pointers into the released memory must not
+        // be used afterwards.
+        void rewind(Mark mark);
+
+        // Releases everything allocated from the arena
+        void reset();
+
+        // Takes over the blocks of `other` without copying them, along with
+        // its registered destructors, and leaves `other` empty. Pointers
+        // into `other` stay valid for the lifetime of this arena, marks
+        // taken on `other` are invalidated. Returns false if either arena
+        // uses `ArenaBackend::Reserved`, whose memory can not be moved.
+        bool adopt(Arena& other);
+
+        bool contains(const void* ptr) const;
+
+        ArenaBackend get_backend() const;
 
         std::size_t get_total_allocated() const;
 
@@ -42,9 +253,77 @@ namespace alvo::mem {
         std::size_t get_block_count() const;
 
     private:
+        void push_block(std::size_t size);
+
+        void pop_block();
+
+        // Runs the registered destructors newer than `until`
+        void run_dtors(DtorRecord* until);
+
+        template<typename T>
+        static void destroy(void* obj) {
+            ArenaDeleter<T>()(static_cast<T*>(obj));
+        }
+
+        ArenaRegion m_region;
         std::vector<ArenaBlock> m_blocks;
         std::size_t m_block_size;
         std::size_t m_total_allocated;
+        // Used bytes of every block but the last one
+        std::size_t m_total_used_prev;
+        BlockPool* m_pool;
+        DtorRecord* m_dtors;
+    };
+
+    // Hands out arenas to worker threads and later merges them into one
+    // owning arena. Every worker allocates from its own arena, so the
+    // allocation path takes no lock.
+    class ArenaGroup {
+    public:
+        ArenaGroup(std::size_t block_size);
+
+        ArenaGroup(const ArenaGroup&) = delete;
+
+        ArenaGroup& operator=(const ArenaGroup&) = delete;
+
+        // Thread safe. The returned arena must only be used by one thread
+        // at a time and stays valid until `merge()`.
+        Arena& create_arena();
+
+        // Adopts the blocks of every arena created so far into the owning
+        // arena. Must not be called while workers still use their arenas.
+        Arena& merge();
+
+        Arena& get_arena();
+
+        std::size_t get_arena_count() const;
+
+    private:
+        std::size_t m_block_size;
+        mutable std::mutex m_mutex;
+        std::deque<Arena> m_arenas;
+        Arena m_arena;
+    };
+
+    // Adapter that lets containers allocate from an `Arena` through
+    // `std::pmr`. Allocation bumps the arena pointer and deallocation is a
+    // no-op: memory is only given back when the arena is rewound or reset.
+    class ArenaResource : public std::pmr::memory_resource {
+    public:
+        ArenaResource(Arena& arena);
+
+        Arena& get_arena() const;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        void do_deallocate(
+            void* ptr, std::size_t bytes, std::size_t alignment) override;
+
+        bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override;
+
+        Arena* m_arena;
     };
 
 }
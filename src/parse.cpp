@@ -99,24 +99,29 @@ namespace alvo::parse {
 
     void SectionEmitter::emit(SectionEvent event) { m_handler(event); }
 
-    Parser::Parser(
-        std::string_view filename, lex::Lexer& lexer, mem::Arena& arena) :
-        m_filename(filename),
-        m_lexer(&lexer),
+    Parser::Parser(const lex::TokenBuffer& tokens, mem::Arena& arena) :
+        m_tokens(&tokens),
+        m_tok_index(0),
         m_arena(&arena),
         m_node_ctx(arena),
         m_section_emitter(nullptr),
-        m_diag_emitter(),
-        m_lexer_next_pushed() {
-        m_lexer_next_pushed.reserve(10);
+        m_diag_emitter(nullptr),
+        m_scratch_arena(SCRATCH_ARENA_BLOCK_SIZE),
+        m_scratch_resource(m_scratch_arena),
+        m_lexer_next_pushed(&m_scratch_resource) {
+        m_lexer_next_pushed.reserve(MAX_PUSHED_TOKENS);
     }
 
     void Parser::set_section_emitter(SectionEmitter& section_emitter) {
         m_section_emitter = &section_emitter;
     }
 
-    void Parser::set_diag_sink(diag::DiagSink& sink) {
-        m_diag_emitter.set_sink(sink);
+    void Parser::set_diag_emitter(diag::DiagEmitter& diag_emitter) {
+        m_diag_emitter = &diag_emitter;
+    }
+
+    void Parser::set_alloc_stats(ast::util::AllocStats& alloc_stats) {
+        m_node_ctx.set_alloc_stats(alloc_stats);
     }
 
     PathSegment Parser::parse_path_segment() {
@@ -130,14 +135,17 @@ namespace alvo::parse {
             val = PathSegment::Super {};
         } else if ((name = accept_and_get(Ident)).has_value()) {
             List<Type> generic_params;
-            std::string_view value = (*name).value;
+            sym::Symbol value = (*name).symbol;
             if (accept(LAngle)) {
-                generic_params.push_back(*m_arena, parse_type());
+                NodeCtx::Mark mark = m_node_ctx.mark();
+                generic_params.push_back(m_node_ctx, parse_type());
                 while (accept(Comma)) {
-                    generic_params.push_back(*m_arena, parse_type());
+                    generic_params.push_back(m_node_ctx, parse_type());
                 }
                 if (!expect(RAngle)) {
                     synchronize({ ColonColon, Dot, Semicolon, Comma, RAngle });
+                    // Generic params are dropped together with the segment
+                    m_node_ctx.rewind(mark);
                     return PathSegment(Invalid {});
                 }
             }
@@ -160,7 +168,7 @@ namespace alvo::parse {
         }
         while (true) {
             if (curr_is(KwRoot) || curr_is(KwSuper) || curr_is(Ident)) {
-                segments.push_back(*m_arena, parse_path_segment());
+                segments.push_back(m_node_ctx, parse_path_segment());
                 if (!accept(ColonColon)) {
                     break;
                 }
@@ -184,7 +192,7 @@ namespace alvo::parse {
                 synchronize({ Semicolon, Eof });
                 return Import(Invalid {}, segments);
             }
-            kind = Import::Renamed { (*name).value };
+            kind = Import::Renamed { (*name).symbol };
         }
         if (!expect(Semicolon)) {
             synchronize({ Semicolon, Eof });
@@ -259,12 +267,12 @@ namespace alvo::parse {
             synchronize(TYPE_CTX_SYNC);
             return Type::Tup(true, types);
         }
-        types.push_back(*m_arena, parse_type());
+        types.push_back(m_node_ctx, parse_type());
         while (accept(Comma)) {
             if (curr_is(RParen)) {
                 break;
             }
-            types.push_back(*m_arena, parse_type());
+            types.push_back(m_node_ctx, parse_type());
         }
         if (!expect(RParen)) {
             synchronize(TYPE_CTX_SYNC);
@@ -286,12 +294,12 @@ namespace alvo::parse {
             return Type::Func(true, params, Ptr<Type>::null());
         }
         if (!curr_is(RParen)) {
-            params.push_back(*m_arena, parse_type());
+            params.push_back(m_node_ctx, parse_type());
             while (accept(Comma)) {
                 if (curr_is(RParen)) {
                     break;
                 }
-                params.push_back(*m_arena, parse_type());
+                params.push_back(m_node_ctx, parse_type());
             }
         }
         if (!expect(RParen)) {
@@ -310,7 +318,7 @@ namespace alvo::parse {
 
         List<PathSegment> segments;
         while (curr_is(KwRoot) || curr_is(KwSuper) || curr_is(Ident)) {
-            segments.push_back(*m_arena, parse_path_segment());
+            segments.push_back(m_node_ctx, parse_path_segment());
             if (!accept(ColonColon)) {
                 break;
             }
@@ -356,17 +364,20 @@ namespace alvo::parse {
         } else if (accept(KwNull)) {
             val = Expr::Literal::Null {};
         } else if ((tok = accept_and_get(LitString)).has_value()) {
-            val = Expr::Literal::String { (*tok).value };
+            val = Expr::Literal::String { std::get<std::string_view>(
+                (*tok).lit) };
         } else if ((tok = accept_and_get(LitCharacter)).has_value()) {
-            val = Expr::Literal::Character { (*tok).value };
+            val = Expr::Literal::Character { std::get<utf8::Codepoint>(
+                (*tok).lit) };
         } else if ((tok = accept_and_get(LitInteger)).has_value()) {
-            val = Expr::Literal::Integer { (*tok).value };
+            val = Expr::Literal::Integer { std::get<std::uint64_t>(
+                (*tok).lit) };
         } else if ((tok = accept_and_get(LitByte)).has_value()) {
-            val = Expr::Literal::Byte { (*tok).value };
+            val = Expr::Literal::Byte { std::get<std::uint8_t>((*tok).lit) };
         } else if ((tok = accept_and_get(LitFloating)).has_value()) {
-            val = Expr::Literal::Floating { (*tok).value };
+            val = Expr::Literal::Floating { std::get<double>((*tok).lit) };
         } else if ((tok = accept_and_get(LitBoolean)).has_value()) {
-            val = Expr::Literal::Boolean { (*tok).value };
+            val = Expr::Literal::Boolean { std::get<bool>((*tok).lit) };
         } else if (curr_is(LBracket)) {
             val = parse_expr_literal_array();
         } else if (curr_is(KwTup)) {
@@ -410,13 +421,13 @@ namespace alvo::parse {
                         m_node_ctx.make_node<Expr>(times));
                 } else {
                     List<Expr> elements;
-                    elements.push_back(*m_arena, first);
+                    elements.push_back(m_node_ctx, first);
                     if (curr_is(Comma)) {
                         while (accept(Comma)) {
                             if (curr_is(RBracket)) {
                                 break;
                             }
-                            elements.push_back(*m_arena, parse_expr());
+                            elements.push_back(m_node_ctx, parse_expr());
                         }
                     }
                     val = Expr::Literal::Array::Regular(elements);
@@ -442,12 +453,12 @@ namespace alvo::parse {
             synchronize(EXPR_CTX_SYNC);
             return Expr::Literal::Tup(true, exprs);
         }
-        exprs.push_back(*m_arena, parse_expr());
+        exprs.push_back(m_node_ctx, parse_expr());
         while (accept(Comma)) {
             if (curr_is(RParen)) {
                 break;
             }
-            exprs.push_back(*m_arena, parse_expr());
+            exprs.push_back(m_node_ctx, parse_expr());
         }
         if (!expect(RParen)) {
             synchronize(EXPR_CTX_SYNC);
@@ -470,12 +481,12 @@ namespace alvo::parse {
             return Expr::Literal::Struct(true, Type(Invalid {}, false), fields);
         }
         if (!curr_is(RBrace)) {
-            fields.push_back(*m_arena, parse_expr_literal_struct_field());
+            fields.push_back(m_node_ctx, parse_expr_literal_struct_field());
             while (accept(Comma)) {
                 if (curr_is(RBrace)) {
                     break;
                 }
-                fields.push_back(*m_arena, parse_expr_literal_struct_field());
+                fields.push_back(m_node_ctx, parse_expr_literal_struct_field());
             }
         }
         if (!expect(RBrace)) {
@@ -490,12 +501,14 @@ namespace alvo::parse {
         std::optional<tok::Tok> tok_name = accept_and_get(Ident);
         if (!tok_name) {
             synchronize(EXPR_CTX_SYNC);
-            return Expr::Literal::Struct::Field(true, "", Ptr<Expr>::null());
+            return Expr::Literal::Struct::Field(
+                true, sym::Symbol(), Ptr<Expr>::null());
         }
-        std::string_view name = (*tok_name).value;
+        sym::Symbol name = (*tok_name).symbol;
         if (!expect(Colon)) {
             synchronize(EXPR_CTX_SYNC);
-            return Expr::Literal::Struct::Field(true, "", Ptr<Expr>::null());
+            return Expr::Literal::Struct::Field(
+                true, sym::Symbol(), Ptr<Expr>::null());
         }
         Ptr<Expr> expr = m_node_ctx.make_node<Expr>(parse_expr());
         return Expr::Literal::Struct::Field(false, name, expr);
@@ -526,7 +539,7 @@ namespace alvo::parse {
     Expr::Builtin Parser::parse_expr_builtin() {
         SectionGuard section_guard(this, __func__);
 
-        std::string_view name = "";
+        sym::Symbol name;
         List<Type> generic_params;
         List<Expr> args;
 
@@ -544,16 +557,16 @@ namespace alvo::parse {
             synchronize(EXPR_CTX_SYNC);
             return Expr::Builtin(true, name, generic_params, args);
         }
-        name = name_tok->value;
+        name = name_tok->symbol;
         if (!expect(RBracket)) {
             synchronize(EXPR_CTX_SYNC);
             return Expr::Builtin(true, name, generic_params, args);
         }
 
         if (accept(LAngle)) {
-            generic_params.push_back(*m_arena, parse_type());
+            generic_params.push_back(m_node_ctx, parse_type());
             while (accept(Comma)) {
-                generic_params.push_back(*m_arena, parse_type());
+                generic_params.push_back(m_node_ctx, parse_type());
             }
             if (!expect(RAngle)) {
                 synchronize(EXPR_CTX_SYNC);
@@ -566,12 +579,12 @@ namespace alvo::parse {
             return Expr::Builtin(true, name, generic_params, args);
         }
         if (!curr_is(RParen)) {
-            args.push_back(*m_arena, parse_expr());
+            args.push_back(m_node_ctx, parse_expr());
             while (accept(Comma)) {
                 if (curr_is(RParen)) {
                     break;
                 }
-                args.push_back(*m_arena, parse_expr());
+                args.push_back(m_node_ctx, parse_expr());
             }
         }
         if (!expect(RParen)) {
@@ -591,9 +604,9 @@ namespace alvo::parse {
             return Block(true, stmts);
         }
         if (!curr_is(RBrace)) {
-            stmts.push_back(*m_arena, parse_stmt());
+            stmts.push_back(m_node_ctx, parse_stmt());
             while (!curr_is(RBrace)) {
-                stmts.push_back(*m_arena, parse_stmt());
+                stmts.push_back(m_node_ctx, parse_stmt());
             }
         }
         if (!expect(RBrace)) {
@@ -643,7 +656,7 @@ namespace alvo::parse {
     Stmt::Let Parser::parse_stmt_let() {
         SectionGuard section_guard(this, __func__);
 
-        std::string_view name;
+        sym::Symbol name;
         std::optional<Type> type = std::nullopt;
         std::optional<Expr> expr = std::nullopt;
         if (!expect(KwLet)) {
@@ -655,7 +668,7 @@ namespace alvo::parse {
             synchronize(STMT_CTX_SYNC);
             return Stmt::Let(true, name, type, expr);
         }
-        name = (*name_tok).value;
+        name = (*name_tok).symbol;
         if (accept(Colon)) {
             type = parse_type();
         }
@@ -683,7 +696,7 @@ namespace alvo::parse {
         while (accept(KwElif)) {
             Expr expr = parse_expr();
             Block block = parse_block();
-            elifs.push_back(*m_arena, Stmt::If::Elif(expr, block));
+            elifs.push_back(m_node_ctx, Stmt::If::Elif(expr, block));
         }
         if (accept(KwElse)) {
             else_ = parse_block();
@@ -705,9 +718,9 @@ namespace alvo::parse {
             return Stmt::Switch(true, Expr(Invalid {}), cases);
         }
         if (!curr_is(RBrace)) {
-            cases.push_back(*m_arena, parse_stmt_switch_case());
+            cases.push_back(m_node_ctx, parse_stmt_switch_case());
             while (!curr_is(RBrace)) {
-                cases.push_back(*m_arena, parse_stmt_switch_case());
+                cases.push_back(m_node_ctx, parse_stmt_switch_case());
             }
         }
         if (!expect(RBrace)) {
@@ -750,20 +763,20 @@ namespace alvo::parse {
 
         if (!expect(KwFor)) {
             synchronize(STMT_CTX_SYNC);
-            return Stmt::For(
-                true, "", Expr(Invalid {}), Block(true, List<Stmt>()));
+            return Stmt::For(true, sym::Symbol(), Expr(Invalid {}),
+                Block(true, List<Stmt>()));
         }
         std::optional<tok::Tok> tok_name = expect_and_get(Ident);
         if (!tok_name) {
             synchronize(STMT_CTX_SYNC);
-            return Stmt::For(
-                true, "", Expr(Invalid {}), Block(true, List<Stmt>()));
+            return Stmt::For(true, sym::Symbol(), Expr(Invalid {}),
+                Block(true, List<Stmt>()));
         }
-        std::string_view name = (*tok_name).value;
+        sym::Symbol name = (*tok_name).symbol;
         if (!expect(Colon)) {
             synchronize(STMT_CTX_SYNC);
-            return Stmt::For(
-                true, "", Expr(Invalid {}), Block(true, List<Stmt>()));
+            return Stmt::For(true, sym::Symbol(), Expr(Invalid {}),
+                Block(true, List<Stmt>()));
         }
         Expr expr = parse_expr();
         Block block = parse_block();
@@ -848,12 +861,12 @@ namespace alvo::parse {
         // `func(self, foo: int)`
         if (!is_self_func || (is_self_func && (accept(Comma)))) {
             if (curr_is(Ident)) {
-                params.push_back(*m_arena, parse_func_signature_param());
+                params.push_back(m_node_ctx, parse_func_signature_param());
                 while (accept(Comma)) {
                     if (curr_is(RParen)) {
                         break;
                     }
-                    params.push_back(*m_arena, parse_func_signature_param());
+                    params.push_back(m_node_ctx, parse_func_signature_param());
                 }
             }
         }
@@ -873,12 +886,14 @@ namespace alvo::parse {
         std::optional<tok::Tok> tok_name = expect_and_get(Ident);
         if (!tok_name) {
             synchronize(EXPR_CTX_SYNC);
-            return Func::Signature::Param(true, "", Type(Invalid {}, false));
+            return Func::Signature::Param(
+                true, sym::Symbol(), Type(Invalid {}, false));
         }
-        std::string_view name = (*tok_name).value;
+        sym::Symbol name = (*tok_name).symbol;
         if (!expect(Colon)) {
             synchronize(EXPR_CTX_SYNC);
-            return Func::Signature::Param(true, "", Type(Invalid {}, false));
+            return Func::Signature::Param(
+                true, sym::Symbol(), Type(Invalid {}, false));
         }
         Type type = parse_type();
         return Func::Signature::Param(false, name, type);
@@ -895,7 +910,7 @@ namespace alvo::parse {
             is_export = true;
         }
 
-        std::string_view name = "";
+        sym::Symbol name;
 
         if (accept(KwDecls)) {
             is_decls_block = true;
@@ -903,29 +918,33 @@ namespace alvo::parse {
             std::optional<tok::Tok> tok_name = expect_and_get(Ident);
             if (!tok_name) {
                 synchronize(TOP_LEVEL_CTX_SYNC);
-                return Decl(
-                    is_export, is_decls_block, "", generic_params, Invalid {});
+                return Decl(is_export, is_decls_block, sym::Symbol(),
+                    generic_params, Invalid {});
             }
-            name = (*tok_name).value;
+            name = (*tok_name).symbol;
         }
 
         if (accept(LAngle)) {
-            generic_params.push_back(*m_arena, parse_decl_generic_param());
+            generic_params.push_back(
+                m_node_ctx, parse_decl_generic_param());
             while (accept(Comma)) {
                 if (curr_is(RAngle)) {
                     break;
                 }
-                generic_params.push_back(*m_arena, parse_decl_generic_param());
+                generic_params.push_back(
+                    m_node_ctx, parse_decl_generic_param());
             }
             if (!expect(RAngle)) {
                 synchronize(TOP_LEVEL_CTX_SYNC);
-                return Decl(is_export, false, "", generic_params, Invalid {});
+                return Decl(is_export, false, sym::Symbol(), generic_params,
+                    Invalid {});
             }
         }
 
         if (!expect(ColonColon)) {
             synchronize(TOP_LEVEL_CTX_SYNC);
-            return Decl(is_export, false, "", generic_params, Invalid {});
+            return Decl(
+                is_export, false, sym::Symbol(), generic_params, Invalid {});
         }
 
         Decl::Val val;
@@ -960,13 +979,13 @@ namespace alvo::parse {
         std::optional<tok::Tok> tok_name = expect_and_get(Ident);
         if (!tok_name) {
             synchronize(ARGLIST_CTX_SYNC);
-            return Decl::GenericParam(true, "", interfaces);
+            return Decl::GenericParam(true, sym::Symbol(), interfaces);
         }
-        std::string_view name = (*tok_name).value;
+        sym::Symbol name = (*tok_name).symbol;
         if (accept(Colon)) {
-            interfaces.push_back(*m_arena, parse_type());
+            interfaces.push_back(m_node_ctx, parse_type());
             while (accept(Plus)) {
-                interfaces.push_back(*m_arena, parse_type());
+                interfaces.push_back(m_node_ctx, parse_type());
             }
         }
         return Decl::GenericParam(false, name, interfaces);
@@ -985,12 +1004,12 @@ namespace alvo::parse {
             return Decl::Struct(true, fields);
         }
         if (curr_is(KwExport) || curr_is(Ident)) {
-            fields.push_back(*m_arena, parse_decl_struct_field());
+            fields.push_back(m_node_ctx, parse_decl_struct_field());
             while (accept(Comma)) {
                 if (curr_is(RBrace)) {
                     break;
                 }
-                fields.push_back(*m_arena, parse_decl_struct_field());
+                fields.push_back(m_node_ctx, parse_decl_struct_field());
             }
         }
         if (!expect(RBrace)) {
@@ -1010,13 +1029,13 @@ namespace alvo::parse {
         if (!tok_name) {
             synchronize(UDTYPE_CTX_SYNC);
             return Decl::Struct::Field(
-                true, "", Type(Invalid {}, false), is_export);
+                true, sym::Symbol(), Type(Invalid {}, false), is_export);
         }
-        std::string_view name = (*tok_name).value;
+        sym::Symbol name = (*tok_name).symbol;
         if (!expect(Colon)) {
             synchronize(UDTYPE_CTX_SYNC);
             return Decl::Struct::Field(
-                true, "", Type(Invalid {}, false), is_export);
+                true, sym::Symbol(), Type(Invalid {}, false), is_export);
         }
         Type type = parse_type();
         return Decl::Struct::Field(false, name, type, is_export);
@@ -1034,12 +1053,12 @@ namespace alvo::parse {
             synchronize(UDTYPE_CTX_SYNC);
             return Decl::Enum(true, elements);
         }
-        elements.push_back(*m_arena, parse_decl_enum_element());
+        elements.push_back(m_node_ctx, parse_decl_enum_element());
         while (accept(Comma)) {
             if (curr_is(RBrace)) {
                 break;
             }
-            elements.push_back(*m_arena, parse_decl_enum_element());
+            elements.push_back(m_node_ctx, parse_decl_enum_element());
         }
         if (!expect(RBrace)) {
             synchronize(UDTYPE_CTX_SYNC);
@@ -1053,9 +1072,9 @@ namespace alvo::parse {
         std::optional<tok::Tok> name = expect_and_get(Ident);
         if (!name) {
             synchronize(UDTYPE_CTX_SYNC);
-            return Decl::Enum::Element(true, "");
+            return Decl::Enum::Element(true, sym::Symbol());
         }
-        return Decl::Enum::Element(false, (*name).value);
+        return Decl::Enum::Element(false, (*name).symbol);
     }
 
     Decl::TypeAlias Parser::parse_decl_type_alias() {
@@ -1114,7 +1133,7 @@ namespace alvo::parse {
             return Decl::Decls(true, type, interface, decls);
         }
         while (!curr_is(RBrace)) {
-            decls.push_back(*m_arena, parse_decl());
+            decls.push_back(m_node_ctx, parse_decl());
         }
         if (!expect(RBrace)) {
             synchronize(UDTYPE_CTX_SYNC);
@@ -1135,7 +1154,7 @@ namespace alvo::parse {
             return Decl::Interface(true, members);
         }
         while (!curr_is(RBrace)) {
-            members.push_back(*m_arena, parse_decl_interface_member());
+            members.push_back(m_node_ctx, parse_decl_interface_member());
         }
         if (!expect(RBrace)) {
             synchronize(UDTYPE_CTX_SYNC);
@@ -1154,29 +1173,31 @@ namespace alvo::parse {
         if (!tok_name) {
             synchronize(UDTYPE_CTX_SYNC);
             return Decl::Interface::Member(
-                false, "", generic_params, signature_invalid);
+                false, sym::Symbol(), generic_params, signature_invalid);
         }
-        std::string_view name = (*tok_name).value;
+        sym::Symbol name = (*tok_name).symbol;
 
         if (accept(LAngle)) {
-            generic_params.push_back(*m_arena, parse_decl_generic_param());
+            generic_params.push_back(
+                m_node_ctx, parse_decl_generic_param());
             while (accept(Comma)) {
                 if (curr_is(RAngle)) {
                     break;
                 }
-                generic_params.push_back(*m_arena, parse_decl_generic_param());
+                generic_params.push_back(
+                    m_node_ctx, parse_decl_generic_param());
             }
             if (!expect(RAngle)) {
                 synchronize(UDTYPE_CTX_SYNC);
                 return Decl::Interface::Member(
-                    false, "", generic_params, signature_invalid);
+                    false, sym::Symbol(), generic_params, signature_invalid);
             }
         }
 
         if (!expect(ColonColon)) {
             synchronize(UDTYPE_CTX_SYNC);
             return Decl::Interface::Member(
-                false, "", generic_params, signature_invalid);
+                false, sym::Symbol(), generic_params, signature_invalid);
         }
 
         Func::Signature signature = parse_func_signature();
@@ -1211,7 +1232,7 @@ namespace alvo::parse {
         while (!curr_is(Eof)) {
             if (curr_is(KwImport) || curr_is(Ident) || curr_is(KwDecls) ||
                 curr_is(KwExport)) {
-                top_levels.push_back(*m_arena, parse_top_level());
+                top_levels.push_back(m_node_ctx, parse_top_level());
             } else {
                 synchronize({ KwImport, Ident, KwDecls, KwExport });
                 // TODO: Err
@@ -1319,7 +1340,7 @@ namespace alvo::parse {
             }
         } else if (curr_is(KwRoot) || curr_is(KwSuper) || curr_is(Ident)) {
             lhs.val = parse_path_segment();
-        } else if ((bp_prefix = prefix_bp(lexer_peek().kind)).has_value()) {
+        } else if ((bp_prefix = prefix_bp(lexer_peek_kind())).has_value()) {
             Expr::Unop::Op op = parse_unop_op();
             Ptr<Expr> expr =
                 m_node_ctx.make_node<Expr>(parse_expr_bp(*bp_prefix));
@@ -1346,12 +1367,16 @@ namespace alvo::parse {
             }
 
             Expr res(Invalid {});
-            Ptr<Expr> res_lhs = m_node_ctx.make_node<Expr>(lhs);
 
-            if ((bp_postfix = postfix_bp(lexer_peek().kind)).has_value()) {
+            if ((bp_postfix = postfix_bp(lexer_peek_kind())).has_value()) {
                 if (*bp_postfix < min_bp) {
                     break;
                 }
+                // Only a failed index or call is rewound, along with the
+                // node taking `lhs`, so the mark lives for one operator
+                NodeCtx::Mark mark = m_node_ctx.mark();
+                // `lhs` only becomes a node once an operator takes it
+                Ptr<Expr> res_lhs = m_node_ctx.make_node<Expr>(lhs);
 
                 if (accept(LBracket)) {
                     res.val = Expr::Index { res_lhs,
@@ -1359,6 +1384,7 @@ namespace alvo::parse {
                     lhs = res;
                     if (!expect(RBracket)) {
                         synchronize(EXPR_CTX_SYNC);
+                        m_node_ctx.rewind(mark);
                         return Expr(Invalid {});
                     }
                 } else if (accept(LParen)) {
@@ -1369,15 +1395,16 @@ namespace alvo::parse {
                         lhs = res;
                         continue;
                     }
-                    args.push_back(*m_arena, parse_expr());
+                    args.push_back(m_node_ctx, parse_expr());
                     while (accept(Comma)) {
                         if (curr_is(RParen)) {
                             break;
                         }
-                        args.push_back(*m_arena, parse_expr());
+                        args.push_back(m_node_ctx, parse_expr());
                     }
                     if (!expect(RParen)) {
                         synchronize(EXPR_CTX_SYNC);
+                        m_node_ctx.rewind(mark);
                         return Expr(Invalid {});
                     }
                     res.val = Expr::Call(expr, args);
@@ -1392,10 +1419,11 @@ namespace alvo::parse {
                 continue;
             }
 
-            if ((bp_infix = infix_bp(lexer_peek().kind)).has_value()) {
+            if ((bp_infix = infix_bp(lexer_peek_kind())).has_value()) {
                 if ((*bp_infix).first < min_bp) {
                     break;
                 }
+                Ptr<Expr> res_lhs = m_node_ctx.make_node<Expr>(lhs);
                 Expr::Binop::Op op = parse_binop_op();
                 Ptr<Expr> res_rhs = m_node_ctx.make_node<Expr>(
                     parse_expr_bp((*bp_infix).second));
@@ -1412,8 +1440,7 @@ namespace alvo::parse {
     Expr::Unop::Op Parser::parse_unop_op() {
         SectionGuard section_guard(this, __func__);
 
-        tok::Tok tok = lexer_next();
-        switch (tok.kind) {
+        switch (lexer_next_kind()) {
             using Unop = Expr::Unop::Op;
         case Plus:
             return Unop::Plus;
@@ -1431,8 +1458,7 @@ namespace alvo::parse {
     Expr::Binop::Op Parser::parse_binop_op() {
         SectionGuard section_guard(this, __func__);
 
-        tok::Tok tok = lexer_next();
-        switch (tok.kind) {
+        switch (lexer_next_kind()) {
             using Binop = Expr::Binop::Op;
         case Eq:
             return Binop::Assign;
@@ -1502,23 +1528,25 @@ namespace alvo::parse {
     }
 
     bool Parser::curr_is(tok::TokKind kind) const {
-        return lexer_peek().kind == kind;
+        return lexer_peek_kind() == kind;
     }
 
     std::optional<tok::Tok> Parser::accept_and_get(tok::TokKind kind) {
+        if (lexer_peek_kind() == kind) {
+            return lexer_next();
+        }
+
         // We need this to resolve cases like this:
         // The current token on the lexer is `>>=`
         // The expected (accepted) token is `>`
         // Split `>>=` into `>` and `>=`, then push `>=` as the next token
-        std::optional<std::pair<tok::Tok, tok::Tok>> split =
-            lexer_peek().split_sep();
-        if (split && (kind == split->first.kind)) {
-            lexer_next();
+        std::optional<std::pair<tok::TokKind, tok::TokKind>> split_kinds =
+            tok::Tok::split_sep_kinds(lexer_peek_kind());
+        if (split_kinds && kind == split_kinds->first) {
+            std::optional<std::pair<tok::Tok, tok::Tok>> split =
+                lexer_next().split_sep();
             lexer_push_next(split->first);
             lexer_push_next(split->second);
-        }
-
-        if (lexer_peek().kind == kind) {
             return lexer_next();
         }
         return std::nullopt;
@@ -1526,14 +1554,19 @@ namespace alvo::parse {
 
     std::optional<tok::Tok> Parser::expect_and_get(tok::TokKind kind) {
         std::optional<tok::Tok> res = accept_and_get(kind);
-        if (!res) {
-            m_diag_emitter.err(m_filename, lexer_peek().loc.s,
-                { diag::Err::UnexpectedToken { lexer_peek() } });
+        if (!res && m_diag_emitter != nullptr) {
+            m_diag_emitter->emit(
+                { diag::Err { diag::Err::UnexpectedToken { lexer_peek() } },
+                    lexer_peek().loc.s });
         }
         return res;
     }
 
     bool Parser::accept(tok::TokKind kind) {
+        if (lexer_peek_kind() == kind) {
+            lexer_next_kind();
+            return true;
+        }
         return accept_and_get(kind).has_value();
     }
 
@@ -1565,28 +1598,63 @@ namespace alvo::parse {
             if (found) {
                 break;
             }
-            lexer_next();
+            lexer_next_kind();
+        }
+    }
+
+    tok::TokKind Parser::lexer_peek_kind() const {
+        if (!m_lexer_next_pushed.empty()) {
+            return m_lexer_next_pushed[0].kind;
         }
+        return m_tokens->kind(m_tok_index);
     }
 
     tok::Tok Parser::lexer_peek() const {
         if (!m_lexer_next_pushed.empty()) {
             return m_lexer_next_pushed[0];
         }
-        return m_lexer->peek();
+        return m_tokens->get(m_tok_index);
+    }
+
+    tok::TokKind Parser::lexer_next_kind() {
+        if (!m_lexer_next_pushed.empty()) {
+            return lexer_pop_pushed().kind;
+        }
+        tok::TokKind res = m_tokens->kind(m_tok_index);
+        if (m_tok_index + 1 < m_tokens->size()) {
+            m_tok_index++;
+        }
+        return res;
     }
 
     tok::Tok Parser::lexer_next() {
         if (!m_lexer_next_pushed.empty()) {
-            tok::Tok res = m_lexer_next_pushed[0];
-            m_lexer_next_pushed.erase(m_lexer_next_pushed.begin());
-            return res;
+            return lexer_pop_pushed();
         }
-        return m_lexer->next();
+        tok::Tok res = m_tokens->get(m_tok_index);
+        if (m_tok_index + 1 < m_tokens->size()) {
+            m_tok_index++;
+        }
+        return res;
     }
 
     void Parser::lexer_push_next(tok::Tok tok) {
         m_lexer_next_pushed.push_back(tok);
     }
 
+    tok::Tok Parser::lexer_pop_pushed() {
+        tok::Tok res = m_lexer_next_pushed[0];
+        m_lexer_next_pushed.erase(m_lexer_next_pushed.begin());
+        // The scratch arena never frees a buffer the queue outgrew, so it is
+        // reset once the queue is empty, which leaves nothing in it alive
+        if (m_lexer_next_pushed.empty() &&
+            m_lexer_next_pushed.capacity() > MAX_PUSHED_TOKENS) {
+            m_lexer_next_pushed =
+                std::pmr::vector<tok::Tok>(&m_scratch_resource);
+            m_scratch_arena.reset();
+            m_lexer_next_pushed.reserve(MAX_PUSHED_TOKENS);
+        }
+        return res;
+    }
+
 }
@@ -1,14 +1,16 @@
 #pragma once
 
 #include <optional>
-#include <functional>
 #include <initializer_list>
+#include <memory_resource>
+#include <vector>
 
 #include "diag.h"
 #include "lex.h"
 #include "tok.h"
 #include "ast.h"
 #include "mem.h"
+#include "util.h"
 
 namespace alvo::parse {
 
@@ -22,7 +24,7 @@ namespace alvo::parse {
         std::string_view section;
     };
 
-    using SectionHandler = std::function<void(SectionEvent)>;
+    using SectionHandler = util::FunctionRef<void(SectionEvent)>;
 
     class SectionEmitter {
     public:
@@ -36,12 +38,14 @@ namespace alvo::parse {
 
     class Parser {
     public:
-        Parser(lex::Lexer& lexer, mem::Arena& arena);
+        Parser(const lex::TokenBuffer& tokens, mem::Arena& arena);
 
         void set_section_emitter(SectionEmitter& section_emitter);
 
         void set_diag_emitter(diag::DiagEmitter& diag_emitter);
 
+        void set_alloc_stats(ast::util::AllocStats& alloc_stats);
+
         ast::PathSegment parse_path_segment();
 
         ast::Import parse_import();
@@ -180,18 +184,37 @@ namespace alvo::parse {
 
         void synchronize(std::initializer_list<tok::TokKind> kinds);
 
+        // The `_kind` variants read only the kind array of the token buffer,
+        // the others build a full token
+        tok::TokKind lexer_peek_kind() const;
+
         tok::Tok lexer_peek() const;
 
+        tok::TokKind lexer_next_kind();
+
         tok::Tok lexer_next();
 
         void lexer_push_next(tok::Tok tok);
 
-        lex::Lexer* m_lexer;
+        tok::Tok lexer_pop_pushed();
+
+        static constexpr std::size_t SCRATCH_ARENA_BLOCK_SIZE = 1024;
+        // Splitting a token queues its two halves and takes the first one
+        // right away, so no more than two tokens are ever pushed
+        static constexpr std::size_t MAX_PUSHED_TOKENS = 2;
+
+        const lex::TokenBuffer* m_tokens;
+        // Index of the current token in `m_tokens`, stays on the final `Eof`
+        std::size_t m_tok_index;
         mem::Arena* m_arena;
         ast::util::NodeCtx m_node_ctx;
         SectionEmitter* m_section_emitter;
         diag::DiagEmitter* m_diag_emitter;
-        std::vector<tok::Tok> m_lexer_next_pushed;
+        // Parser-local containers are kept out of the node arena, so that
+        // rewinding it never releases their storage
+        mem::Arena m_scratch_arena;
+        mem::ArenaResource m_scratch_resource;
+        std::pmr::vector<tok::Tok> m_lexer_next_pushed;
     };
 
 }
@@ -0,0 +1,261 @@
+#include "source.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  define ALVO_MMAP 1
+#else
+#  include <cstdio>
+#  define ALVO_MMAP 0
+#endif
+
+namespace alvo::source {
+
+    static constexpr std::size_t READ_CHUNK_SIZE = 64 * 1024;
+    // The offset of `Eof`, one past the last byte, must fit in a `tok::Pos`
+    static constexpr std::size_t MAX_SOURCE_SIZE = UINT32_MAX;
+
+    static char* _alloc_buffer(std::size_t size) {
+        char* res = static_cast<char*>(std::malloc(size));
+        if (res == nullptr) {
+            throw std::bad_alloc();
+        }
+        return res;
+    }
+
+    // Reads chunks with `read_some(dst, max)` until it returns 0 and pads
+    // them. `read_some` returns a negative value on errors, which leave
+    // `err` set and return null.
+    template<typename F>
+    static char* _read_all(F&& read_some, std::size_t& size, LoadError& err) {
+        std::size_t capacity = READ_CHUNK_SIZE;
+        char* data = _alloc_buffer(capacity);
+        size = 0;
+        while (true) {
+            // Leave room for the padding
+            if (capacity - size < READ_CHUNK_SIZE + PADDING) {
+                capacity *= 2;
+                char* grown = static_cast<char*>(std::realloc(data, capacity));
+                if (grown == nullptr) {
+                    std::free(data);
+                    throw std::bad_alloc();
+                }
+                data = grown;
+            }
+            long n = read_some(data + size, READ_CHUNK_SIZE);
+            if (n < 0) {
+                std::free(data);
+                err = LoadError::Read;
+                return nullptr;
+            }
+            if (n == 0) {
+                break;
+            }
+            size += (std::size_t)n;
+            if (size > MAX_SOURCE_SIZE) {
+                std::free(data);
+                err = LoadError::TooLarge;
+                return nullptr;
+            }
+        }
+        std::memset(data + size, 0, PADDING);
+        return data;
+    }
+
+#if ALVO_MMAP
+    // Maps `size` bytes of `fd` in front of zeroed anonymous memory, so
+    // that the padding is always mapped, even when the file ends on a page
+    // boundary
+    static char* _map_fd(int fd, std::size_t size, std::size_t& mapped_size) {
+        std::size_t page_size = (std::size_t)sysconf(_SC_PAGESIZE);
+        mapped_size =
+            (size + PADDING + page_size - 1) / page_size * page_size;
+        void* base = mmap(nullptr, mapped_size, PROT_READ,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            return nullptr;
+        }
+        if (mmap(base, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) ==
+            MAP_FAILED) {
+            munmap(base, mapped_size);
+            return nullptr;
+        }
+        madvise(base, size, MADV_SEQUENTIAL);
+        return static_cast<char*>(base);
+    }
+#endif
+
+    SourceFile::SourceFile(std::string_view src) :
+        m_data(_alloc_buffer(src.size() + PADDING)),
+        m_size(src.size()),
+        m_mapped_size(0),
+        m_line_starts() {
+        std::memcpy(m_data, src.data(), src.size());
+        std::memset(m_data + m_size, 0, PADDING);
+    }
+
+    SourceFile::SourceFile(
+        char* data, std::size_t size, std::size_t mapped_size) :
+        m_data(data),
+        m_size(size),
+        m_mapped_size(mapped_size),
+        m_line_starts() { }
+
+    SourceFile::SourceFile(SourceFile&& other) noexcept :
+        m_data(std::exchange(other.m_data, nullptr)),
+        m_size(std::exchange(other.m_size, 0)),
+        m_mapped_size(std::exchange(other.m_mapped_size, 0)),
+        m_line_starts(std::move(other.m_line_starts)) { }
+
+    SourceFile& SourceFile::operator=(SourceFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_mapped_size = std::exchange(other.m_mapped_size, 0);
+            m_line_starts = std::move(other.m_line_starts);
+        }
+        return *this;
+    }
+
+    SourceFile::~SourceFile() { release(); }
+
+    LoadResult SourceFile::load(const char* path) {
+        std::size_t size = 0;
+        LoadError err = LoadError::Read;
+#if ALVO_MMAP
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return tl::make_unexpected(LoadError::Open);
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            return tl::make_unexpected(LoadError::Read);
+        }
+        if (S_ISREG(st.st_mode) && st.st_size > 0) {
+            size = (std::size_t)st.st_size;
+            if (size > MAX_SOURCE_SIZE) {
+                close(fd);
+                return tl::make_unexpected(LoadError::TooLarge);
+            }
+            std::size_t mapped_size = 0;
+            char* data = _map_fd(fd, size, mapped_size);
+            if (data != nullptr) {
+                close(fd);
+                return SourceFile(data, size, mapped_size);
+            }
+        }
+        char* data = _read_all(
+            [&](char* dst, std::size_t max) -> long {
+                while (true) {
+                    ssize_t n = read(fd, dst, max);
+                    if (n >= 0 || errno != EINTR) {
+                        return (long)n;
+                    }
+                }
+            },
+            size, err);
+        close(fd);
+#else
+        std::FILE* file = std::fopen(path, "rb");
+        if (file == nullptr) {
+            return tl::make_unexpected(LoadError::Open);
+        }
+        char* data = _read_all(
+            [&](char* dst, std::size_t max) -> long {
+                std::size_t n = std::fread(dst, 1, max, file);
+                if (n == 0 && std::ferror(file)) {
+                    return -1;
+                }
+                return (long)n;
+            },
+            size, err);
+        std::fclose(file);
+#endif
+        if (data == nullptr) {
+            return tl::make_unexpected(err);
+        }
+        return SourceFile(data, size, 0);
+    }
+
+    SourceFile SourceFile::edited(
+        std::size_t begin, std::size_t end, std::string_view text) const {
+        std::size_t size = m_size - (end - begin) + text.size();
+        char* data = _alloc_buffer(size + PADDING);
+        std::memcpy(data, m_data, begin);
+        if (!text.empty()) {
+            std::memcpy(data + begin, text.data(), text.size());
+        }
+        std::memcpy(data + begin + text.size(), m_data + end, m_size - end);
+        std::memset(data + size, 0, PADDING);
+        return SourceFile(data, size, 0);
+    }
+
+    std::string_view SourceFile::get_src() const {
+        return std::string_view(m_data, m_size);
+    }
+
+    bool SourceFile::is_mapped() const { return m_mapped_size != 0; }
+
+    LineCol SourceFile::line_col(tok::Pos pos) const {
+        build_line_index();
+        std::uint32_t offset = std::min(pos.offset, (std::uint32_t)m_size);
+        auto line_it = std::upper_bound(
+            m_line_starts.begin(), m_line_starts.end(), offset);
+        std::uint32_t line = (std::uint32_t)(line_it - m_line_starts.begin());
+        std::uint32_t column = 1;
+        // Skip UTF-8 continuation bytes, columns count codepoints
+        for (std::uint32_t i = *std::prev(line_it); i < offset; i++) {
+            if (((unsigned char)m_data[i] & 0xC0) != 0x80) {
+                column++;
+            }
+        }
+        return LineCol { line, column };
+    }
+
+    std::size_t SourceFile::get_line_count() const {
+        build_line_index();
+        return m_line_starts.size();
+    }
+
+    void SourceFile::release() {
+        if (m_data == nullptr) {
+            return;
+        }
+#if ALVO_MMAP
+        if (m_mapped_size != 0) {
+            munmap(m_data, m_mapped_size);
+            m_data = nullptr;
+            return;
+        }
+#endif
+        std::free(m_data);
+        m_data = nullptr;
+    }
+
+    void SourceFile::build_line_index() const {
+        if (!m_line_starts.empty()) {
+            return;
+        }
+        m_line_starts.push_back(0);
+        const char* begin = m_data;
+        const char* end = begin + m_size;
+        const char* it = begin;
+        while ((it = (const char*)std::memchr(it, '\n', end - it)) != nullptr) {
+            it++;
+            m_line_starts.push_back((std::uint32_t)(it - begin));
+        }
+    }
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <tl/expected.hpp>
+
+#include "tok.h"
+
+namespace alvo::source {
+
+    // 1-based line and column, columns count codepoints
+    struct LineCol {
+        std::uint32_t l;
+        std::uint32_t c;
+    };
+
+    // Zero bytes after the text of every `SourceFile`. The first one is the
+    // sentinel, the rest let scanners read a whole vector past the end.
+    static constexpr std::size_t PADDING = 64;
+
+    enum class LoadError {
+        Open,
+        Read,
+        // Offsets into a source must fit in 32 bits
+        TooLarge,
+    };
+
+    class SourceFile;
+
+    using LoadResult = tl::expected<SourceFile, LoadError>;
+
+    // Source text of one file, always followed by `PADDING` zero bytes that
+    // are not part of `get_src()`. Tokens and diagnostics only carry byte
+    // offsets, the offset of every line start is found on the first
+    // conversion to a line and column.
+    class SourceFile {
+    public:
+        // Copies `src`
+        explicit SourceFile(std::string_view src);
+
+        SourceFile(const SourceFile&) = delete;
+
+        SourceFile(SourceFile&& other) noexcept;
+
+        SourceFile& operator=(const SourceFile&) = delete;
+
+        SourceFile& operator=(SourceFile&& other) noexcept;
+
+        ~SourceFile();
+
+        // Maps regular files privately and reads everything else, like
+        // pipes and empty files, into a buffer
+        static LoadResult load(const char* path);
+
+        // Copies the source with the bytes `[begin, end)` replaced by `text`
+        SourceFile edited(
+            std::size_t begin, std::size_t end, std::string_view text) const;
+
+        std::string_view get_src() const;
+
+        bool is_mapped() const;
+
+        // Not thread-safe, the first call builds the line index
+        LineCol line_col(tok::Pos pos) const;
+
+        std::size_t get_line_count() const;
+
+    private:
+        SourceFile(char* data, std::size_t size, std::size_t mapped_size);
+
+        void release();
+
+        void build_line_index() const;
+
+        // `m_size` bytes of source followed by the padding
+        char* m_data;
+        std::size_t m_size;
+        // Size of the mapping, zero if `m_data` came from `malloc` and is
+        // released with `free`
+        std::size_t m_mapped_size;
+        // Byte offset of the start of each line, empty until first needed
+        mutable std::vector<std::uint32_t> m_line_starts;
+    };
+
+}
+
+template<>
+struct fmt::formatter<alvo::source::LineCol> {
+    constexpr auto parse(fmt::format_parse_context& ctx) { return ctx.begin(); }
+
+    auto format(const alvo::source::LineCol& obj,
+        fmt::format_context& ctx) const {
+        return fmt::format_to(ctx.out(), "{}:{}", obj.l, obj.c);
+    }
+};
@@ -0,0 +1,95 @@
+#include "sym.h"
+
+#include <cstring>
+#include <utility>
+
+namespace alvo::sym {
+
+    SymbolTable::SymbolTable(mem::Arena& arena) :
+        m_arena(&arena),
+        m_slots(INITIAL_CAPACITY, Slot { 0, 0 }),
+        m_entries() { }
+
+    Symbol SymbolTable::intern(std::string_view str) {
+        std::uint32_t h = hash(str);
+        std::size_t i = probe(str, h);
+        if (m_slots[i].index != 0) {
+            return Symbol(m_entries[m_slots[i].index - 1]);
+        }
+
+        char* data = static_cast<char*>(m_arena->alloc(str.size() + 1, 1));
+        std::memcpy(data, str.data(), str.size());
+        data[str.size()] = '\0';
+        std::uint32_t id = static_cast<std::uint32_t>(m_entries.size());
+        const Symbol::Entry* entry = m_arena->make<Symbol::Entry>(
+            Symbol::Entry { id, h, std::string_view(data, str.size()) });
+        m_entries.push_back(entry);
+        m_slots[i] = Slot { h, id + 1 };
+
+        // Keep the load factor at or below one half
+        if (m_entries.size() * 2 > m_slots.size()) {
+            grow();
+        }
+        return Symbol(entry);
+    }
+
+    Symbol SymbolTable::find(std::string_view str) const {
+        std::size_t i = probe(str, hash(str));
+        if (m_slots[i].index == 0) {
+            return Symbol();
+        }
+        return Symbol(m_entries[m_slots[i].index - 1]);
+    }
+
+    Symbol SymbolTable::get(std::uint32_t id) const {
+        if (id >= m_entries.size()) {
+            return Symbol();
+        }
+        return Symbol(m_entries[id]);
+    }
+
+    std::size_t SymbolTable::size() const { return m_entries.size(); }
+
+    std::uint32_t SymbolTable::hash(std::string_view str) {
+        // FNV-1a, identifiers are short
+        std::uint32_t h = 2166136261u;
+        for (char c : str) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    std::size_t SymbolTable::probe(
+        std::string_view str, std::uint32_t hash) const {
+        std::size_t mask = m_slots.size() - 1;
+        std::size_t i = hash & mask;
+        while (true) {
+            const Slot& slot = m_slots[i];
+            if (slot.index == 0) {
+                return i;
+            }
+            if (slot.hash == hash && m_entries[slot.index - 1]->str == str) {
+                return i;
+            }
+            i = (i + 1) & mask;
+        }
+    }
+
+    void SymbolTable::grow() {
+        std::vector<Slot> slots(m_slots.size() * 2, Slot { 0, 0 });
+        std::size_t mask = slots.size() - 1;
+        for (const Slot& slot : m_slots) {
+            if (slot.index == 0) {
+                continue;
+            }
+            std::size_t i = slot.hash & mask;
+            while (slots[i].index != 0) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = slot;
+        }
+        m_slots = std::move(slots);
+    }
+
+}
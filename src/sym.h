@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include "mem.h"
+
+namespace alvo::sym {
+
+    // Interned identifier. Symbols from the same `SymbolTable` are equal
+    // only if their strings are equal, so comparing and hashing them never
+    // looks at the string itself. A symbol points at its entry rather than
+    // holding the 32-bit id, so `str()` works without the table, `id()`
+    // indexes side tables.
+    class Symbol {
+    public:
+        Symbol() :
+            m_entry(nullptr) { }
+
+        bool is_null() const { return m_entry == nullptr; }
+
+        // Dense index in the order the symbols were interned
+        std::uint32_t id() const { return m_entry->id; }
+
+        std::string_view str() const {
+            if (m_entry == nullptr) {
+                return std::string_view();
+            }
+            return m_entry->str;
+        }
+
+        friend bool operator==(Symbol lhs, Symbol rhs) {
+            return lhs.m_entry == rhs.m_entry;
+        }
+
+        friend bool operator!=(Symbol lhs, Symbol rhs) {
+            return lhs.m_entry != rhs.m_entry;
+        }
+
+    private:
+        friend class SymbolTable;
+
+        struct Entry {
+            std::uint32_t id;
+            std::uint32_t hash;
+            std::string_view str;
+        };
+
+        Symbol(const Entry* entry) :
+            m_entry(entry) { }
+
+        const Entry* m_entry;
+    };
+
+    // Open-addressing hash table of interned strings. The strings and their
+    // entries live in `arena`, which must outlive every symbol. The slots
+    // and the entry index are on the heap, the arena could not take back
+    // the arrays they outgrow.
+    class SymbolTable {
+    public:
+        SymbolTable(mem::Arena& arena);
+
+        SymbolTable(const SymbolTable&) = delete;
+
+        SymbolTable& operator=(const SymbolTable&) = delete;
+
+        Symbol intern(std::string_view str);
+
+        // Returns a null symbol if `str` was never interned
+        Symbol find(std::string_view str) const;
+
+        Symbol get(std::uint32_t id) const;
+
+        std::size_t size() const;
+
+    private:
+        // `index` is one past the entry index, zero marks an empty slot
+        struct Slot {
+            std::uint32_t hash;
+            std::uint32_t index;
+        };
+
+        static constexpr std::size_t INITIAL_CAPACITY = 256;
+
+        static std::uint32_t hash(std::string_view str);
+
+        // Returns the slot holding `str` or the empty slot it would go in
+        std::size_t probe(std::string_view str, std::uint32_t hash) const;
+
+        void grow();
+
+        mem::Arena* m_arena;
+        std::vector<Slot> m_slots;
+        std::vector<const Symbol::Entry*> m_entries;
+    };
+
+}
+
+namespace std {
+
+    template<>
+    struct hash<alvo::sym::Symbol> {
+        std::size_t operator()(alvo::sym::Symbol sym) const noexcept {
+            return sym.is_null() ? 0 : std::hash<std::uint32_t>()(sym.id());
+        }
+    };
+
+}
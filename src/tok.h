@@ -2,25 +2,26 @@
 
 #include <cstdint>
 #include <optional>
+#include <string_view>
 #include <utility>
+#include <variant>
 
 #include <fmt/format.h>
 
+#include "sym.h"
+#include "utf8.h"
+
 namespace alvo::tok {
 
+    // Byte offset into the source, `source::SourceFile` turns it into a
+    // line and column
     struct Pos {
-        std::uint32_t l;
-        std::uint32_t c;
         std::uint32_t offset;
 
         Pos() :
-            l(1),
-            c(1),
             offset(0) { }
 
-        Pos(std::uint32_t l, std::uint32_t c, std::uint32_t offset) :
-            l(l),
-            c(c),
+        Pos(std::uint32_t offset) :
             offset(offset) { }
     };
 
@@ -39,6 +40,8 @@ namespace alvo::tok {
         Loc merge(Loc other) { return Loc(s, other.e); }
     };
 
+    static_assert(sizeof(Loc) == 8, "Loc must stay two byte offsets");
+
     enum class TokKind {
         // Special
         Continue = -4,
@@ -148,25 +151,56 @@ namespace alvo::tok {
         Count
     };
 
+    // Decoded value of a literal token: `LitInteger`, `LitFloating`,
+    // `LitByte` and `LitCharacter` hold the number or codepoint, `LitString`
+    // the text with its escapes resolved and `LitBoolean` a `bool`
+    using LitVal = std::variant<std::monostate, std::uint64_t, double,
+        std::uint8_t, utf8::Codepoint, std::string_view, bool>;
+
     struct Tok {
         Loc loc;
         TokKind kind;
         std::string_view value;
+        // Interned `value` of `Ident` tokens, null for every other kind
+        sym::Symbol symbol;
+        // Empty for every kind but the literals
+        LitVal lit;
 
         Tok() :
             loc(),
             kind(TokKind::None),
-            value() { }
+            value(),
+            symbol(),
+            lit() { }
 
         Tok(Loc loc, TokKind kind) :
             loc(loc),
             kind(kind),
-            value() { }
+            value(),
+            symbol(),
+            lit() { }
 
         Tok(Loc loc, TokKind kind, std::string_view value) :
             loc(loc),
             kind(kind),
-            value(value) { }
+            value(value),
+            symbol(),
+            lit() { }
+
+        Tok(Loc loc, TokKind kind, std::string_view value,
+            sym::Symbol symbol) :
+            loc(loc),
+            kind(kind),
+            value(value),
+            symbol(symbol),
+            lit() { }
+
+        Tok(Loc loc, TokKind kind, std::string_view value, LitVal lit) :
+            loc(loc),
+            kind(kind),
+            value(value),
+            symbol(),
+            lit(lit) { }
 
         bool is_continue() const { return kind == TokKind::Continue; }
 
@@ -176,7 +210,9 @@ namespace alvo::tok {
 
         bool is_none() const { return kind == TokKind::None; }
 
-        std::optional<std::pair<Tok, Tok>> split_sep() const {
+        // Kinds of the two tokens a compound separator of `kind` splits into
+        static std::optional<std::pair<TokKind, TokKind>> split_sep_kinds(
+            TokKind kind) {
             std::pair<TokKind, TokKind> kinds;
             switch (kind) {
                 using enum TokKind;
@@ -319,14 +355,23 @@ namespace alvo::tok {
             case TokKind::Count:
                 return std::nullopt;
             }
+            return kinds;
+        }
+
+        std::optional<std::pair<Tok, Tok>> split_sep() const {
+            std::optional<std::pair<TokKind, TokKind>> kinds =
+                split_sep_kinds(kind);
+            if (!kinds) {
+                return std::nullopt;
+            }
             Tok first = *this;
-            first.kind = kinds.first;
-            first.loc.e.c--;
+            first.kind = kinds->first;
+            first.loc.e.offset = first.loc.s.offset + 1;
             first.value =
                 std::string_view(first.value.begin(), first.value.begin() + 1);
             Tok second = *this;
-            second.kind = kinds.second;
-            second.loc.s.c++;
+            second.kind = kinds->second;
+            second.loc.s.offset++;
             second.value =
                 std::string_view(second.value.begin() + 1, second.value.end());
             return std::make_pair(first, second);
@@ -340,7 +385,7 @@ struct fmt::formatter<alvo::tok::Pos> {
     constexpr auto parse(fmt::format_parse_context& ctx) { return ctx.begin(); }
 
     auto format(const alvo::tok::Pos& obj, fmt::format_context& ctx) const {
-        return fmt::format_to(ctx.out(), "{}:{}", obj.l, obj.c);
+        return fmt::format_to(ctx.out(), "{}", obj.offset);
     }
 };
 
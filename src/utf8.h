@@ -9,21 +9,72 @@ namespace alvo::utf8 {
 
     using Codepoint = int32_t;
 
+    // Returns the number of leading ASCII bytes of `view`, looking at up to
+    // 32 bytes at a time where SIMD is available
+    std::size_t ascii_prefix_length(std::string_view view);
+
+    // Returns the length of the longest prefix of `view` that is valid
+    // UTF-8, which is the offset of the first invalid byte if there is one.
+    // ASCII runs are skipped with `ascii_prefix_length()`.
+    std::size_t valid_prefix_length(std::string_view view);
+
+    // Returns the number of leading bytes of `view` that are printable ASCII
+    // other than `quote` and the backslash, which a quoted literal passes
+    // over without decoding. Scans like `ascii_prefix_length()`.
+    std::size_t quoted_run_length(std::string_view view, char quote);
+
+    // Writes the encoding of `c` to `out` and returns its length in bytes
+    std::size_t encode(Codepoint c, char (&out)[4]);
+
     class Utf8Iter {
     public:
-        Utf8Iter(std::string_view view);
-
-        std::optional<Codepoint> next();
+        // The first `valid_size` bytes of `view` must be valid UTF-8, see
+        // `valid_prefix_length()`. They are decoded without any checks. With
+        // `sentinel` all of `view` must be valid and followed by a NUL byte,
+        // which is read as a last codepoint `0` like any ASCII byte.
+        Utf8Iter(std::string_view view, std::size_t valid_size = 0,
+            bool sentinel = false);
+
+        // Inside a known run of ASCII bytes this only loads the next byte,
+        // everything else goes through `decode_next()`
+        std::optional<Codepoint> next() {
+            std::optional<Codepoint> res = m_curr;
+            if (m_byte_offset < m_ascii_end) {
+                m_curr =
+                    static_cast<unsigned char>(m_view.data()[m_byte_offset]);
+                m_byte_offset++;
+            } else {
+                decode_next();
+            }
+            return res;
+        }
 
         std::optional<Codepoint> peek() const;
 
+        // Returns the codepoint `n` after the one `peek()` returns without
+        // moving, `peek(0)` is `peek()`
+        std::optional<Codepoint> peek(std::size_t n) const;
+
         std::size_t byte_offset() const;
 
+        // Continues at `offset`, which must be the start of a codepoint
+        void seek(std::size_t offset);
+
         bool eof() const;
 
     private:
+        // Bytes scanned ahead for ASCII at once, keeps the scan in cache
+        static constexpr std::size_t ASCII_SCAN_SIZE = 1024;
+
+        void decode_next();
+
         std::string_view m_view;
         std::size_t m_byte_offset;
+        // End of the ASCII run that `m_byte_offset` is in
+        std::size_t m_ascii_end;
+        std::size_t m_valid_end;
+        // One past the sentinel if there is one, the end of `m_view` if not
+        std::size_t m_end;
         std::optional<Codepoint> m_curr;
     };
 
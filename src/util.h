@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 namespace alvo::util {
     template<typename... Ts>
     struct overload : Ts... {
@@ -7,4 +11,33 @@ namespace alvo::util {
     };
     template<class... Ts>
     overload(Ts...) -> overload<Ts...>;
+
+    template<typename Sig>
+    class FunctionRef;
+
+    // Non-owning reference to a callable, a call goes through one function
+    // pointer and nothing is ever allocated. Only lvalues bind, the callable
+    // must outlive the reference.
+    template<typename R, typename... Args>
+    class FunctionRef<R(Args...)> {
+    public:
+        template<typename F>
+            requires(std::is_object_v<F> &&
+                     !std::is_same_v<std::remove_const_t<F>, FunctionRef> &&
+                     std::is_invocable_r_v<R, F&, Args...>)
+        FunctionRef(F& f) :
+            m_obj(const_cast<void*>(
+                static_cast<const void*>(std::addressof(f)))),
+            m_call([](void* obj, Args... args) -> R {
+                return (*static_cast<F*>(obj))(std::forward<Args>(args)...);
+            }) { }
+
+        R operator()(Args... args) const {
+            return m_call(m_obj, std::forward<Args>(args)...);
+        }
+
+    private:
+        void* m_obj;
+        R (*m_call)(void*, Args...);
+    };
 }
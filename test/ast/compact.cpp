@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <new>
+#include <string_view>
+
+#include <ast.h>
+#include <lex.h>
+#include <mem.h>
+#include <parse.h>
+#include <source.h>
+#include <sym.h>
+
+using namespace alvo;
+
+TEST_CASE("Compacted AST equals the original", "[ast::compact]") {
+    static constexpr std::string_view src =
+        "import root::foo::bar;\n"
+        "Point<T: Show> :: struct { x: T, y: T }\n"
+        "main :: func(argc: int) -> int {\n"
+        "    let xs: [int] = [1, 2, 3];\n"
+        "    if argc > 1 { return xs[0]; } elif argc == 0 { return 1; }\n"
+        "    for x: xs { defer print(x as string); }\n"
+        "    return argc * (2 + 3) - 1;\n"
+        "}\n";
+
+    mem::Arena symbol_arena(1024);
+    sym::SymbolTable symbols(symbol_arena);
+    source::SourceFile source(src);
+    lex::Lexer lexer(source, symbols, symbol_arena);
+    mem::Arena arena(1024);
+    lex::TokenBuffer tokens = lexer.tokenize_all();
+    parse::Parser parser(tokens, arena);
+    ast::Module module = parser.parse_module();
+
+    mem::Arena dst(1024);
+    ast::Module compacted = ast::compact(module, dst);
+    REQUIRE(compacted == module);
+    REQUIRE(compacted.top_levels.size() == module.top_levels.size());
+    REQUIRE(dst.get_total_used() <= arena.get_total_used());
+
+    // List nodes are placed back to back, ahead of their subtrees
+    auto first = compacted.top_levels.begin();
+    auto second = first;
+    ++second;
+    REQUIRE(dst.contains(&*first));
+    REQUIRE(!arena.contains(&*first));
+    REQUIRE(reinterpret_cast<const char*>(&*first) <
+            reinterpret_cast<const char*>(&*second));
+}
+
+TEST_CASE("Compactor copies arrays back to back", "[ast::compact]") {
+    mem::Arena src(1024);
+    int* values[3];
+    for (int i = 0; i < 3; i++) {
+        values[i] = src.make<int>(i + 1);
+    }
+    auto* data = static_cast<ast::util::Ptr<int>*>(src.alloc(
+        sizeof(ast::util::Ptr<int>) * 3, alignof(ast::util::Ptr<int>)));
+    for (int i = 0; i < 3; i++) {
+        new (data + i) ast::util::Ptr<int>(values[i]);
+    }
+    ast::util::Array<ast::util::Ptr<int>> array(data, 3);
+
+    mem::Arena dst(1024);
+    ast::util::Array<ast::util::Ptr<int>> copy = ast::compact(array, dst);
+    REQUIRE(copy.size() == 3);
+    REQUIRE(dst.contains(&copy[0]));
+    for (std::size_t i = 0; i < 3; i++) {
+        REQUIRE(&copy[i] == &copy[0] + i);
+        REQUIRE(dst.contains(copy[i].get_ptr()));
+        REQUIRE(*copy[i] == (int)i + 1);
+    }
+    // The elements come before the values they point to
+    REQUIRE(reinterpret_cast<const char*>(&copy[2]) <
+            reinterpret_cast<const char*>(copy[0].get_ptr()));
+}
@@ -0,0 +1,42 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <ast.h>
+#include <lex.h>
+#include <mem.h>
+#include <parse.h>
+#include <source.h>
+#include <sym.h>
+
+using namespace alvo;
+
+TEST_CASE("Printer escapes decoded literal values", "[ast::print]") {
+    static constexpr std::string_view src =
+        "main :: func() {\n"
+        "    let s = \"a\\n\\r\\t\\0\\\\\\'\\\"b\";\n"
+        "    let c = '\\n';\n"
+        "}\n";
+
+    mem::Arena symbol_arena(1024);
+    sym::SymbolTable symbols(symbol_arena);
+    source::SourceFile source(src);
+    lex::Lexer lexer(source, symbols, symbol_arena);
+    lex::TokenBuffer tokens = lexer.tokenize_all();
+    mem::Arena arena(1024);
+    parse::Parser parser(tokens, arena);
+    ast::Module module = parser.parse_module();
+
+    std::string out;
+    ast::print::OutputIteratorSink sink(std::back_inserter(out));
+    ast::Printer printer(sink, 1);
+    printer.print_node(module);
+
+    REQUIRE(out.find("`a\\n\\r\\t\\0\\\\\\'\\\"b`") != std::string::npos);
+    REQUIRE(out.find("`\\n`") != std::string::npos);
+    REQUIRE(out.find('\r') == std::string::npos);
+    REQUIRE(out.find('\t') == std::string::npos);
+    REQUIRE(out.find('\0') == std::string::npos);
+}
@@ -0,0 +1,592 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <diag.h>
+#include <lex.h>
+#include <mem.h>
+#include <source.h>
+#include <sym.h>
+#include <tok.h>
+
+using namespace alvo;
+
+TEST_CASE("Lexer reports invalid UTF-8 once", "[Lexer]") {
+    std::vector<diag::Diag> diags;
+    auto collect = [&](const diag::Diag& diag) { diags.push_back(diag); };
+    diag::DiagEmitter diag_emitter(collect);
+
+    mem::Arena symbol_arena(1024);
+    sym::SymbolTable symbols(symbol_arena);
+    std::string_view src = "let x = 1;\nlet y\xFF = 2;";
+    source::SourceFile source(src);
+    lex::Lexer lexer(source, symbols, symbol_arena);
+    lexer.set_diag_emitter(diag_emitter);
+
+    std::vector<tok::TokKind> kinds;
+    while (true) {
+        tok::Tok tok = lexer.next();
+        kinds.push_back(tok.kind);
+        if (tok.is_eof()) {
+            break;
+        }
+    }
+
+    using enum tok::TokKind;
+    std::vector<tok::TokKind> expected = { KwLet, Ident, Eq, LitInteger,
+        Semicolon, KwLet, Ident, Err, Eof };
+    REQUIRE(kinds == expected);
+    REQUIRE(diags.size() == 1);
+    auto* err = std::get_if<diag::Err>(&diags[0].val);
+    REQUIRE(err != nullptr);
+    REQUIRE(std::holds_alternative<diag::Err::InvalidUtf8>(err->val));
+    REQUIRE(diags[0].pos.offset == 16);
+    REQUIRE(source.line_col(diags[0].pos).l == 2);
+}
+
+TEST_CASE("Lexer classifies ASCII and Unicode characters", "[Lexer]") {
+    mem::Arena symbol_arena(1024);
+    sym::SymbolTable symbols(symbol_arena);
+    // U+00A0 and U+3000 are spaces, Greek and CJK letters start identifiers
+    source::SourceFile source(
+        "_x1\t\xC3\xA9t\xC3\xA9\xC2\xA0\xCE\xB1\xCE\xB2 = 0xfF;"
+        "\xE3\x80\x80\xE5\xAD\x97 'c' \"s\" 1_0.5 ab$c");
+    lex::Lexer lexer(source, symbols, symbol_arena);
+
+    std::vector<tok::Tok> toks;
+    while (true) {
+        tok::Tok tok = lexer.next();
+        toks.push_back(tok);
+        if (tok.is_eof()) {
+            break;
+        }
+    }
+
+    using enum tok::TokKind;
+    std::vector<tok::TokKind> expected = { Ident, Ident, Ident, Eq,
+        LitInteger, Semicolon, Ident, LitCharacter, LitString, LitFloating,
+        Ident, Err, Eof };
+    std::vector<tok::TokKind> kinds;
+    for (const tok::Tok& tok : toks) {
+        kinds.push_back(tok.kind);
+    }
+    REQUIRE(kinds == expected);
+    REQUIRE(toks[1].value == "\xC3\xA9t\xC3\xA9");
+    REQUIRE(toks[2].value == "\xCE\xB1\xCE\xB2");
+    REQUIRE(toks[6].value == "\xE5\xAD\x97");
+    REQUIRE(toks[10].value == "ab");
+    REQUIRE(toks[11].value == "$c");
+}
+
+TEST_CASE("Lexer recognizes keywords and boolean literals", "[Lexer]") {
+    mem::Arena symbol_arena(1024);
+    sym::SymbolTable symbols(symbol_arena);
+    source::SourceFile source("__builtin as true false try_as tup type "
+                              "trues fals t x __builtins stuct");
+    lex::Lexer lexer(source, symbols, symbol_arena);
+
+    std::vector<tok::TokKind> kinds;
+    while (true) {
+        tok::Tok tok = lexer.next();
+        kinds.push_back(tok.kind);
+        if (tok.is_eof()) {
+            break;
+        }
+    }
+
+    using enum tok::TokKind;
+    std::vector<tok::TokKind> expected = { KwBuiltin, KwAs, LitBoolean,
+        LitBoolean, KwTryAs, KwTup, KwType, Ident, Ident, Ident, Ident,
+        Ident, Ident, Eof };
+    REQUIRE(kinds == expected);
+}
+
+TEST_CASE("Lexer decodes literal values", "[Lexer]") {
+    using enum tok::TokKind;
+    struct Case {
+        std::string_view src;
+        tok::TokKind kind;
+        tok::LitVal lit;
+    };
+    Case cases[] = {
+        { "0", LitInteger, std::uint64_t(0) },
+        { "1_000", LitInteger, std::uint64_t(1000) },
+        { "0x_Ff", LitInteger, std::uint64_t(255) },
+        { "0o17", LitInteger, std::uint64_t(15) },
+        { "0b1010", LitInteger, std::uint64_t(10) },
+        { "18446744073709551615", LitInteger, UINT64_MAX },
+        { "0xFFFF_FFFF_FFFF_FFFF", LitInteger, UINT64_MAX },
+        { "255y", LitByte, std::uint8_t(255) },
+        { "0x7fy", LitByte, std::uint8_t(127) },
+        { "1_000.25", LitFloating, 1000.25 },
+        { "0.1", LitFloating, 0.1 },
+        // Too long to strip the separators on the stack
+        { "1_000_000_000_000_000_000_000_000_000_000"
+          "_000_000_000_000_000_000_000_000_000_000.5",
+            LitFloating, 1e60 },
+        { "\"a\\tb\\\\\\\"\\0\"", LitString,
+            std::string_view("a\tb\\\"\0", 6) },
+        { "\"plain\"", LitString, std::string_view("plain") },
+        { "\"\"", LitString, std::string_view() },
+        { "'x'", LitCharacter, utf8::Codepoint('x') },
+        { "'\\''", LitCharacter, utf8::Codepoint('\'') },
+        { "'\\n'", LitCharacter, utf8::Codepoint('\n') },
+        { "'\xE2\x82\xAC'", LitCharacter, utf8::Codepoint(0x20AC) },
+        { "true", LitBoolean, true },
+        { "false", LitBoolean, false },
+    };
+
+    for (const Case& c : cases) {
+        mem::Arena symbol_arena(1024);
+        sym::SymbolTable symbols(symbol_arena);
+        source::SourceFile source(c.src);
+        lex::Lexer lexer(source, symbols, symbol_arena);
+        tok::Tok tok = lexer.next();
+        REQUIRE(tok.kind == c.kind);
+        REQUIRE(tok.lit == c.lit);
+        REQUIRE(lexer.next().is_eof());
+    }
+}
+
+TEST_CASE("Lexer scans long strings and comments", "[Lexer]") {
+    using enum tok::TokKind;
+    // Escapes, non-ASCII and the closing quote at every position around the
+    // SIMD widths
+    struct Special {
+        std::string_view src;
+        std::string_view decoded;
+    };
+    Special specials[] = {
+        { "\\n", "\n" },
+        { "\\\"", "\"" },
+        { "\xC3\xA9", "\xC3\xA9" },
+        { "'", "'" },
+        { "", "" },
+    };
+    for (const Special& special : specials) {
+        for (std::size_t pos = 0; pos < 70; pos++) {
+            std::string body =
+                std::string(pos, 'a') + std::string(special.src) + "bc";
+            std::string decoded =
+                std::string(pos, 'a') + std::string(special.decoded) + "bc";
+            std::string src = "x \"" + body + "\" // " + body + "\xC3\xA9\ny";
+
+            mem::Arena symbol_arena(1024);
+            sym::SymbolTable symbols(symbol_arena);
+            source::SourceFile source(src);
+            lex::Lexer lexer(source, symbols, symbol_arena);
+            REQUIRE(lexer.next().kind == Ident);
+            tok::Tok str = lexer.next();
+            REQUIRE(str.kind == LitString);
+            REQUIRE(str.loc.s.offset == 2);
+            REQUIRE(str.loc.e.offset == 2 + body.size() + 2);
+            REQUIRE(std::get<std::string_view>(str.lit) == decoded);
+            tok::Tok ident = lexer.next();
+            REQUIRE(ident.kind == Ident);
+            REQUIRE(ident.loc.s.offset == src.size() - 1);
+            REQUIRE(lexer.next().is_eof());
+        }
+    }
+
+    // A control byte or an invalid byte stops a string and a comment
+    for (std::size_t pos = 0; pos < 70; pos++) {
+        std::string run(pos, 'a');
+        std::vector<tok::TokKind> kinds;
+        for (std::string src :
+            { "\"" + run + "\t\"", "\"" + run, "// " + run + "\xFF" }) {
+            mem::Arena symbol_arena(1024);
+            sym::SymbolTable symbols(symbol_arena);
+            source::SourceFile source(src);
+            lex::Lexer lexer(source, symbols, symbol_arena);
+            kinds.push_back(lexer.next().kind);
+        }
+        REQUIRE(kinds == std::vector<tok::TokKind> { Err, Err, Err });
+    }
+}
+
+TEST_CASE("Lexer reports literals without a value", "[Lexer]") {
+    struct Case {
+        std::string_view src;
+        std::size_t err_index;
+        // Offset of the diagnostic, the start of the literal unless it is
+        // about an escape
+        std::uint32_t offset;
+    };
+    // Past the largest double, `from_chars` reports it out of range
+    std::string huge_float = " 1" + std::string(400, '0') + ".0";
+    Case cases[] = {
+        { huge_float,
+            diag::Err::Val(diag::Err::FloatingPointLiteralOutOfRange {})
+                .index(),
+            1 },
+        { " 18446744073709551616",
+            diag::Err::Val(diag::Err::IntegerLiteralTooLarge {}).index(), 1 },
+        { " 0x1_0000_0000_0000_0000",
+            diag::Err::Val(diag::Err::IntegerLiteralTooLarge {}).index(), 1 },
+        { " 256y", diag::Err::Val(diag::Err::ByteLiteralTooLarge {}).index(),
+            1 },
+        { " \"a\\qb\"",
+            diag::Err::Val(diag::Err::UnknownEscapeSequence {}).index(), 3 },
+        { " \"\\n\\t\\z\"",
+            diag::Err::Val(diag::Err::UnknownEscapeSequence {}).index(), 6 },
+        { " 'ab'",
+            diag::Err::Val(diag::Err::InvalidCharacterLiteralLength {})
+                .index(),
+            1 },
+        { " ''",
+            diag::Err::Val(diag::Err::InvalidCharacterLiteralLength {})
+                .index(),
+            1 },
+        { " 'abcdef'",
+            diag::Err::Val(diag::Err::InvalidCharacterLiteralLength {})
+                .index(),
+            1 },
+    };
+
+    for (const Case& c : cases) {
+        mem::Arena symbol_arena(1024);
+        sym::SymbolTable symbols(symbol_arena);
+        source::SourceFile source(c.src);
+        std::vector<diag::Diag> diags;
+        auto collect = [&](const diag::Diag& diag) { diags.push_back(diag); };
+        diag::DiagEmitter diag_emitter(collect);
+        // Takes the emitter before lexing the first token
+        lex::TokenBuffer tokens = lex::Lexer::tokenize_parallel(
+            source, symbols, symbol_arena, 1, &diag_emitter);
+        REQUIRE(tokens.size() == 2);
+        REQUIRE(tokens.kind(0) == tok::TokKind::Err);
+        REQUIRE(diags.size() == 1);
+        const auto* err = std::get_if<diag::Err>(&diags[0].val);
+        REQUIRE(err != nullptr);
+        REQUIRE(err->val.index() == c.err_index);
+        REQUIRE(diags[0].pos.offset == c.offset);
+    }
+}
+
+TEST_CASE("TokenBuffer matches tokens lexed one by one", "[Lexer]") {
+    std::string_view sources[] = {
+        "",
+        "main :: func() -> int {\n    return 0;\n}\n",
+        "let \xC3\xA9t\xC3\xA9 = \"\xE2\x82\xAC\"; // comment\r\n"
+        "x >>= 0x1F;\n\n\t$ y = 1.5 z",
+        "let x = 1;\nlet y\xFF = 2;",
+    };
+
+    for (std::string_view src : sources) {
+        mem::Arena symbol_arena(1024);
+        sym::SymbolTable symbols(symbol_arena);
+        source::SourceFile source(src);
+        lex::Lexer lexer(source, symbols, symbol_arena);
+        std::vector<tok::Tok> expected;
+        while (true) {
+            tok::Tok tok = lexer.next();
+            expected.push_back(tok);
+            if (tok.is_eof()) {
+                break;
+            }
+        }
+
+        // The trailing `Eof` is not emitted
+        std::vector<tok::TokKind> emitted;
+        auto collect = [&](const tok::Tok& tok) {
+            emitted.push_back(tok.kind);
+        };
+        lex::TokEmitter tok_emitter(collect);
+        lex::Lexer buffered_lexer(source, symbols, symbol_arena);
+        buffered_lexer.set_tok_emitter(tok_emitter);
+        lex::TokenBuffer tokens = buffered_lexer.tokenize_all();
+        REQUIRE(tokens.size() == expected.size());
+        REQUIRE(emitted.size() == expected.size() - 1);
+        for (std::size_t i = 0; i < emitted.size(); i++) {
+            REQUIRE(emitted[i] == expected[i].kind);
+        }
+        for (std::size_t i = 0; i < tokens.size(); i++) {
+            tok::Tok tok = tokens.get(i);
+            REQUIRE(tok.kind == expected[i].kind);
+            REQUIRE(tok.value == expected[i].value);
+            REQUIRE(tok.lit == expected[i].lit);
+            REQUIRE(tok.symbol == expected[i].symbol);
+            REQUIRE(tok.loc.s.offset == expected[i].loc.s.offset);
+            REQUIRE(tok.loc.e.offset == expected[i].loc.e.offset);
+        }
+    }
+}
+
+TEST_CASE("Lexer stops at the sentinel", "[Lexer]") {
+    using enum tok::TokKind;
+    struct Case {
+        std::string_view src;
+        std::vector<tok::TokKind> expected;
+    };
+    Case cases[] = {
+        { "x >>= 10", { Ident, RAngleRAngleEq, LitInteger, Eof } },
+        // The first character is only read once
+        { "0", { LitInteger, Eof } },
+        { "\"abc\"", { LitString, Eof } },
+        { ">>=", { RAngleRAngleEq, Eof } },
+        { "0x", { Err, Eof } },
+        { "\"abc", { Err, Eof } },
+        { "a // comment", { Ident, Eof } },
+        { "1.", { LitInteger, Dot, Eof } },
+        { "1.x", { LitInteger, Dot, Ident, Eof } },
+        { "0.x", { LitInteger, Dot, Ident, Eof } },
+        { "0.5", { LitFloating, Eof } },
+        { "1.5.x", { LitFloating, Dot, Ident, Eof } },
+        // A NUL inside the source is an unexpected character, not the end
+        { std::string_view("a\0b c", 5), { Ident, Err, Ident, Eof } },
+        { std::string_view("\"a\0\" b", 6), { Err, Ident, Eof } },
+    };
+
+    for (const Case& c : cases) {
+        mem::Arena symbol_arena(1024);
+        sym::SymbolTable symbols(symbol_arena);
+        source::SourceFile source(c.src);
+        lex::Lexer lexer(source, symbols, symbol_arena);
+        std::vector<tok::TokKind> kinds;
+        while (true) {
+            tok::Tok tok = lexer.next();
+            kinds.push_back(tok.kind);
+            if (tok.is_eof()) {
+                break;
+            }
+        }
+        REQUIRE(kinds == c.expected);
+    }
+}
+
+TEST_CASE("Lexer peeks characters without advancing", "[Lexer]") {
+    mem::Arena symbol_arena(1024);
+    sym::SymbolTable symbols(symbol_arena);
+    source::SourceFile source("ab \xC3\xA9");
+    lex::Lexer lexer(source, symbols, symbol_arena);
+
+    // Lexing `ab` stopped on the space
+    REQUIRE(lexer.peek_ch(0) == ' ');
+    REQUIRE(lexer.peek_ch() == 0x00E9);
+    REQUIRE(lexer.peek_ch(1) == 0x00E9);
+    REQUIRE(lexer.peek_ch(2) == 0);
+    REQUIRE(lexer.peek_ch(3) == 0);
+    REQUIRE(lexer.peek_ch(0) == ' ');
+    REQUIRE(lexer.peek().kind == tok::TokKind::Ident);
+}
+
+TEST_CASE("Parallel lexing matches sequential lexing", "[Lexer]") {
+    // Every chunk boundary lands somewhere in a mix of strings holding
+    // comment markers, comments holding quotes, errors, Unicode and CRLF
+    std::string_view snippets[] = {
+        "main :: func() -> int {\n    return 0;\n}\n",
+        "let s = \"// not a comment\"; // \"not a string\"\n",
+        "let c = '\\''; x >>= 0x1F;\r\n",
+        "let e = \"tab\\there\\n\" + 1_000y;\n",
+        "let \xC3\xA9t\xC3\xA9 = \"\xE2\x82\xAC\";\n\n\t",
+        "$ y = 1.5 z 0b2 1.5b\n",
+        "let u = \"unterminated\n",
+        "//\n",
+        std::string_view("a\0b = 1;\n", 9),
+    };
+    std::string corpus;
+    for (std::size_t i = 0; i < 40; i++) {
+        corpus += std::string_view(snippets[(i * 7) % std::size(snippets)]);
+    }
+
+    struct Lexed {
+        std::vector<tok::Tok> toks;
+        std::vector<diag::Diag> diags;
+    };
+    auto lex_sequential = [](const source::SourceFile& source,
+                              sym::SymbolTable& symbols, mem::Arena& arena) {
+        Lexed res;
+        auto collect = [&](const diag::Diag& diag) {
+            res.diags.push_back(diag);
+        };
+        diag::DiagEmitter diag_emitter(collect);
+        lex::Lexer lexer(source, symbols, arena, &diag_emitter);
+        lex::TokenBuffer tokens = lexer.tokenize_all();
+        for (std::size_t i = 0; i < tokens.size(); i++) {
+            res.toks.push_back(tokens.get(i));
+        }
+        return res;
+    };
+    auto lex_parallel = [](const source::SourceFile& source,
+                            sym::SymbolTable& symbols, mem::Arena& arena,
+                            std::size_t chunks) {
+        Lexed res;
+        auto collect = [&](const diag::Diag& diag) {
+            res.diags.push_back(diag);
+        };
+        diag::DiagEmitter diag_emitter(collect);
+        lex::TokenBuffer tokens = lex::Lexer::tokenize_parallel(
+            source, symbols, arena, chunks, &diag_emitter);
+        for (std::size_t i = 0; i < tokens.size(); i++) {
+            res.toks.push_back(tokens.get(i));
+        }
+        return res;
+    };
+
+    std::string sources[] = {
+        corpus,
+        corpus + "let tail\xFF = 1;\n",
+        std::string(corpus.data(), corpus.size() - 1),
+        "one_line_only",
+        "",
+        // The first token is an error
+        "\"unterminated\n" + corpus,
+        "'c",
+        "\xFF = 1;\n",
+    };
+    for (const std::string& src : sources) {
+        source::SourceFile source(src);
+        mem::Arena symbol_arena(1024);
+        sym::SymbolTable symbols(symbol_arena);
+        Lexed expected = lex_sequential(source, symbols, symbol_arena);
+
+        for (std::size_t chunks : { 1, 2, 3, 7, 16, 1000 }) {
+            mem::Arena parallel_arena(1024);
+            sym::SymbolTable parallel_symbols(parallel_arena);
+            Lexed actual = lex_parallel(
+                source, parallel_symbols, parallel_arena, chunks);
+
+            REQUIRE(actual.toks.size() == expected.toks.size());
+            for (std::size_t i = 0; i < actual.toks.size(); i++) {
+                const tok::Tok& tok = actual.toks[i];
+                REQUIRE(tok.kind == expected.toks[i].kind);
+                REQUIRE(tok.value == expected.toks[i].value);
+                REQUIRE(tok.lit == expected.toks[i].lit);
+                REQUIRE(tok.loc.s.offset == expected.toks[i].loc.s.offset);
+                REQUIRE(tok.loc.e.offset == expected.toks[i].loc.e.offset);
+                REQUIRE(tok.symbol.is_null() ==
+                        expected.toks[i].symbol.is_null());
+                if (!tok.symbol.is_null()) {
+                    REQUIRE(tok.symbol.id() == expected.toks[i].symbol.id());
+                }
+            }
+
+            REQUIRE(actual.diags.size() == expected.diags.size());
+            for (std::size_t i = 0; i < actual.diags.size(); i++) {
+                const diag::Diag& diag = actual.diags[i];
+                REQUIRE(diag.pos.offset == expected.diags[i].pos.offset);
+                const auto* err = std::get_if<diag::Err>(&diag.val);
+                const auto* expected_err =
+                    std::get_if<diag::Err>(&expected.diags[i].val);
+                REQUIRE(err != nullptr);
+                REQUIRE(expected_err != nullptr);
+                REQUIRE(err->val.index() == expected_err->val.index());
+            }
+        }
+    }
+}
+
+TEST_CASE("Relexing an edit matches lexing the edited source", "[Lexer]") {
+    std::string_view src = "main :: func() -> int {\n"
+                           "    let s = \"a // b\"; // \"c\"\n"
+                           "    let \xC3\xA9t\xC3\xA9 = x >>= 0x1F;\n"
+                           "    return 1.5;\n"
+                           "}\n"
+                           "let tail = 1;\xFF\n";
+    std::size_t size = src.size();
+    lex::Edit edits[] = {
+        { 0, 0, "" },
+        { 0, 0, "x" },
+        { 0, 4, "" },
+        { 27, 27, "\"" },
+        { 27, 28, "//" },
+        { 23, 24, "" },
+        { 23, 24, " " },
+        { 40, 40, "\n" },
+        { 62, 63, "" },
+        { 61, 62, "\xE2\x82" },
+        { 64, 66, "" },
+        { 68, 70, "= y" },
+        { 80, 80, " \"a\\tb\" 'c' '\\n' 12y 0x_f" },
+        { 75, 90, "" },
+        { size - 2, size - 1, "" },
+        { size - 2, size - 1, "\xC3\xA9" },
+        { size - 1, size, "\xFF" },
+        { size, size, " z" },
+        { 10, size - 10, "" },
+        { 0, size, "a\nb" },
+    };
+
+    for (const lex::Edit& edit : edits) {
+        mem::Arena symbol_arena(1024);
+        sym::SymbolTable symbols(symbol_arena);
+        source::SourceFile source(src);
+        lex::Lexer lexer(source, symbols, symbol_arena);
+        lex::TokenBuffer relexed = lexer.tokenize_all();
+
+        source::SourceFile edited =
+            source.edited(edit.begin, edit.end, edit.text);
+        lex::Lexer::relex(relexed, edited, edit, symbols);
+        lex::Lexer edited_lexer(edited, symbols, symbol_arena);
+        lex::TokenBuffer expected = edited_lexer.tokenize_all();
+
+        REQUIRE(relexed.size() == expected.size());
+        for (std::size_t i = 0; i < relexed.size(); i++) {
+            tok::Tok tok = relexed.get(i);
+            tok::Tok expected_tok = expected.get(i);
+            REQUIRE(tok.kind == expected_tok.kind);
+            REQUIRE(tok.value == expected_tok.value);
+            REQUIRE(tok.lit == expected_tok.lit);
+            REQUIRE(tok.symbol == expected_tok.symbol);
+            REQUIRE(tok.loc.s.offset == expected_tok.loc.s.offset);
+            REQUIRE(tok.loc.e.offset == expected_tok.loc.e.offset);
+        }
+    }
+}
+
+TEST_CASE("Relexing edits in place keeps the buffer in sync", "[Lexer]") {
+    std::string line = "let s = \"a\\t" + std::string(200, 'b') +
+                       "\"; let n = 0x1F;\n";
+    std::string src;
+    for (int i = 0; i < 64; i++) {
+        src += line;
+    }
+    mem::Arena symbol_arena(1024);
+    sym::SymbolTable symbols(symbol_arena);
+    source::SourceFile source(src);
+    lex::Lexer lexer(source, symbols, symbol_arena);
+    lex::TokenBuffer tokens = lexer.tokenize_all();
+    std::size_t initial_usage = tokens.get_memory_usage();
+
+    // Edits jump back and forth across the source, inserting and removing
+    // lines with decoded strings
+    std::uint32_t state = 1;
+    for (int step = 0; step < 2000; step++) {
+        state = state * 1103515245 + 12345;
+        std::size_t line_index = (state >> 8) % 64;
+        std::size_t begin = line_index * line.size();
+        lex::Edit edit = step % 2 == 0
+                             ? lex::Edit { begin, begin, line }
+                             : lex::Edit { begin, begin + line.size(), "" };
+        source::SourceFile edited =
+            source.edited(edit.begin, edit.end, edit.text);
+        lex::Lexer::relex(tokens, edited, edit, symbols);
+        source = std::move(edited);
+
+        if (step % 97 != 0 && step != 1999) {
+            continue;
+        }
+        lex::Lexer fresh_lexer(source, symbols, symbol_arena);
+        lex::TokenBuffer expected = fresh_lexer.tokenize_all();
+        REQUIRE(tokens.size() == expected.size());
+        for (std::size_t i = 0; i < tokens.size(); i++) {
+            tok::Tok tok = tokens.get(i);
+            tok::Tok expected_tok = expected.get(i);
+            REQUIRE(tok.kind == expected_tok.kind);
+            REQUIRE(tok.value == expected_tok.value);
+            REQUIRE(tok.lit == expected_tok.lit);
+            REQUIRE(tok.symbol == expected_tok.symbol);
+            REQUIRE(tok.loc.s.offset == expected_tok.loc.s.offset);
+            REQUIRE(tok.loc.e.offset == expected_tok.loc.e.offset);
+        }
+    }
+
+    // Replaced literals are reclaimed, so memory doesn't grow with the
+    // number of edits
+    REQUIRE(tokens.get_memory_usage() < 2 * initial_usage + 64 * 1024);
+}
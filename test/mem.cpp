@@ -2,6 +2,12 @@
 
 #include <cstddef>
 #include <array>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <memory_resource>
+#include <new>
 
 #include <mem.h>
 
@@ -463,3 +469,484 @@ TEST_CASE("Can allocate from Arena", "[Arena]") {
         test_mem(ptr, 998);
     }
 }
+
+TEST_CASE("Can rewind Arena to a mark", "[Arena]") {
+    static constexpr std::size_t block_size = 1024;
+    Arena arena(block_size);
+
+    SECTION("Rewind empty arena") {
+        Arena::Mark mark = arena.mark();
+        arena.alloc(100, 1);
+        arena.alloc(block_size * 2, 8);
+        REQUIRE(arena.get_block_count() == 2);
+        arena.rewind(mark);
+        REQUIRE(arena.get_block_count() == 0);
+        REQUIRE(arena.get_total_allocated() == 0);
+        REQUIRE(arena.get_total_used() == 0);
+    }
+
+    SECTION("Rewind within a block") {
+        void* ptr;
+
+        ptr = arena.alloc(100, 1);
+        test_mem(ptr, 100);
+        Arena::Mark mark = arena.mark();
+
+        ptr = arena.alloc(200, 8);
+        test_mem(ptr, 200);
+        REQUIRE(arena.get_total_used() == 104 + 200);
+
+        arena.rewind(mark);
+        REQUIRE(arena.get_block_count() == 1);
+        REQUIRE(arena.get_total_allocated() == block_size);
+        REQUIRE(arena.get_total_used() == 100);
+
+        // Released memory is only zeroed on request
+        ptr = arena.alloc(200, 1, true);
+        REQUIRE(ptr != nullptr);
+        test_mem(ptr, 200);
+        REQUIRE(arena.get_total_used() == 300);
+    }
+
+    SECTION("Rewind releases trailing blocks") {
+        void* ptr;
+
+        ptr = arena.alloc(1000, 1);
+        test_mem(ptr, 1000);
+        Arena::Mark mark = arena.mark();
+
+        ptr = arena.alloc(500, 1);
+        test_mem(ptr, 500);
+        ptr = arena.alloc(block_size * 3, 16);
+        test_mem(ptr, block_size * 3);
+        ptr = arena.alloc(10, 1);
+        test_mem(ptr, 10);
+        REQUIRE(arena.get_block_count() == 3);
+
+        arena.rewind(mark);
+        REQUIRE(arena.get_block_count() == 1);
+        REQUIRE(arena.get_total_allocated() == block_size);
+        REQUIRE(arena.get_total_used() == 1000);
+
+        ptr = arena.alloc(24, 1);
+        REQUIRE(ptr != nullptr);
+        test_mem(ptr, 24);
+        REQUIRE(arena.get_block_count() == 1);
+    }
+
+    SECTION("Nested marks") {
+        arena.alloc(10, 1);
+        Arena::Mark outer = arena.mark();
+        arena.alloc(20, 1);
+        Arena::Mark inner = arena.mark();
+        arena.alloc(block_size, 1);
+        REQUIRE(arena.get_block_count() == 2);
+
+        arena.rewind(inner);
+        REQUIRE(arena.get_block_count() == 1);
+        REQUIRE(arena.get_total_used() == 30);
+
+        arena.rewind(outer);
+        REQUIRE(arena.get_block_count() == 1);
+        REQUIRE(arena.get_total_used() == 10);
+    }
+}
+
+TEST_CASE("ArenaBlock zeroes reused memory only on request", "[ArenaBlock]") {
+    static constexpr std::size_t block_size = 1024;
+    ArenaBlock block(block_size);
+
+    void* ptr = block.alloc(256, 1);
+    test_mem(ptr, 256);
+    REQUIRE(block.dirty() == 256);
+
+    block.rewind(0);
+    REQUIRE(block.used() == 0);
+    REQUIRE(block.dirty() == 256);
+
+    // Partially overlaps the dirty range
+    ptr = block.alloc(512, 1, true);
+    REQUIRE(ptr != nullptr);
+    test_is_zeroed(ptr, 512);
+    REQUIRE(block.dirty() == 512);
+
+    // Fresh memory past the high-water mark is zero without an explicit
+    // request
+    ptr = block.alloc(128, 1);
+    test_is_zeroed(ptr, 128);
+}
+
+TEST_CASE("ArenaBlock reads as zero after a discard", "[ArenaBlock]") {
+    // Small blocks come from the heap, large ones are mapped
+    for (std::size_t block_size : { 1024, 256 * 1024 }) {
+        ArenaBlock block(block_size);
+        void* ptr = block.alloc(block_size, 1);
+        test_mem(ptr, block_size);
+
+        block.discard();
+        REQUIRE(block.used() == 0);
+        REQUIRE(block.dirty() == 0);
+        ptr = block.alloc(block_size, 1);
+        test_is_zeroed(ptr, block_size);
+    }
+}
+
+TEST_CASE("ArenaBlock can be moved", "[ArenaBlock]") {
+    ArenaBlock block(1024);
+    void* ptr = block.alloc(100, 1);
+    test_write(ptr, 100);
+
+    ArenaBlock moved(std::move(block));
+    REQUIRE(moved.size() == 1024);
+    REQUIRE(moved.used() == 100);
+    REQUIRE(block.size() == 0);
+    REQUIRE(block.used() == 0);
+    REQUIRE(static_cast<char*>(ptr)[99] == 42);
+}
+
+TEST_CASE("Can allocate from a reserved Arena", "[Arena]") {
+    static constexpr std::size_t block_size = 4096;
+    static constexpr std::size_t reserve_size = 1 << 24;
+    Arena arena(block_size, ArenaBackend::Reserved, reserve_size);
+    if (arena.get_backend() != ArenaBackend::Reserved) {
+        SKIP("Virtual memory reservation is not supported");
+    }
+    REQUIRE(arena.get_block_count() == 0);
+    REQUIRE(arena.get_total_allocated() == 0);
+    REQUIRE(arena.get_total_used() == 0);
+
+    SECTION("Allocations are contiguous") {
+        char* first = static_cast<char*>(arena.alloc(10, 1));
+        REQUIRE(first != nullptr);
+        test_mem(first, 10);
+        REQUIRE(arena.get_block_count() == 1);
+        REQUIRE(arena.get_total_used() == 10);
+
+        char* second = static_cast<char*>(arena.alloc(100, 16));
+        REQUIRE(second == first + 16);
+        test_mem(second, 100);
+
+        // Crosses the commit granularity
+        char* big = static_cast<char*>(arena.alloc(block_size * 3, 8));
+        REQUIRE(big == first + 120);
+        test_mem(big, block_size * 3);
+        REQUIRE(arena.get_block_count() == 1);
+        REQUIRE(arena.get_total_allocated() >= 120 + block_size * 3);
+
+        REQUIRE(arena.contains(first));
+        REQUIRE(arena.contains(big + block_size * 3 - 1));
+        int local = 0;
+        REQUIRE_FALSE(arena.contains(&local));
+    }
+
+    SECTION("Invalid allocations") {
+        REQUIRE(arena.alloc(0, 1) == nullptr);
+        REQUIRE(arena.alloc(10, 3) == nullptr);
+        REQUIRE(arena.alloc(reserve_size + 1, 1) == nullptr);
+        REQUIRE(arena.get_total_used() == 0);
+    }
+
+    SECTION("Rewind") {
+        arena.alloc(100, 1);
+        Arena::Mark mark = arena.mark();
+        void* ptr = arena.alloc(block_size * 2, 1);
+        test_write(ptr, block_size * 2);
+        arena.rewind(mark);
+        REQUIRE(arena.get_total_used() == 100);
+
+        ptr = arena.alloc(block_size, 1, true);
+        REQUIRE(ptr != nullptr);
+        test_is_zeroed(ptr, block_size);
+    }
+}
+
+TEST_CASE("Block Arena reports contained pointers", "[Arena]") {
+    Arena arena(1024);
+    REQUIRE(arena.get_backend() == ArenaBackend::Blocks);
+    char* first = static_cast<char*>(arena.alloc(1000, 1));
+    char* second = static_cast<char*>(arena.alloc(1000, 1));
+    REQUIRE(arena.contains(first));
+    REQUIRE(arena.contains(second + 999));
+    int local = 0;
+    REQUIRE_FALSE(arena.contains(&local));
+}
+
+TEST_CASE("Arenas recycle blocks through a BlockPool", "[BlockPool]") {
+    static constexpr std::size_t block_size = 1024;
+
+    SECTION("Blocks are returned on destruction and reused") {
+        BlockPool pool(block_size * 16);
+        void* first_ptr;
+        {
+            Arena arena(block_size);
+            arena.set_block_pool(pool);
+            first_ptr = arena.alloc(100, 1);
+            arena.alloc(block_size, 1);
+            REQUIRE(arena.get_block_count() == 2);
+            REQUIRE(pool.get_block_count() == 0);
+        }
+        REQUIRE(pool.get_block_count() == 2);
+        REQUIRE(pool.get_pooled_bytes() == block_size * 2);
+
+        Arena arena(block_size);
+        arena.set_block_pool(pool);
+        void* ptr = arena.alloc(100, 1);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(pool.get_block_count() == 1);
+        REQUIRE(arena.get_total_allocated() == block_size);
+        REQUIRE((ptr == first_ptr || arena.contains(ptr)));
+    }
+
+    SECTION("Reset and rewind return blocks") {
+        BlockPool pool(block_size * 16);
+        Arena arena(block_size);
+        arena.set_block_pool(pool);
+        arena.alloc(100, 1);
+        Arena::Mark mark = arena.mark();
+        arena.alloc(block_size, 1);
+        arena.alloc(block_size * 4, 1);
+        REQUIRE(arena.get_block_count() == 3);
+
+        arena.rewind(mark);
+        REQUIRE(arena.get_block_count() == 1);
+        REQUIRE(pool.get_block_count() == 2);
+
+        arena.reset();
+        REQUIRE(arena.get_block_count() == 0);
+        REQUIRE(arena.get_total_allocated() == 0);
+        REQUIRE(pool.get_block_count() == 3);
+        REQUIRE(pool.get_pooled_bytes() == block_size * 6);
+
+        // Best fit: the big block is kept for big requests
+        arena.alloc(1, 1);
+        void* ptr = arena.alloc(block_size * 3, 1);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(arena.get_block_count() == 2);
+        REQUIRE(arena.get_total_allocated() == block_size * 5);
+        REQUIRE(pool.get_pooled_bytes() == block_size);
+    }
+
+    SECTION("High-water mark") {
+        BlockPool pool(block_size * 2);
+        {
+            Arena arena(block_size);
+            arena.set_block_pool(pool);
+            for (int i = 0; i < 4; i++) {
+                arena.alloc(block_size, 1);
+            }
+        }
+        REQUIRE(pool.get_block_count() == 2);
+        REQUIRE(pool.get_pooled_bytes() == block_size * 2);
+    }
+
+    SECTION("Discarded blocks read as zero") {
+        BlockPool pool(block_size * 16, true);
+        {
+            Arena arena(block_size);
+            arena.set_block_pool(pool);
+            test_write(arena.alloc(block_size, 1), block_size);
+        }
+        Arena arena(block_size);
+        arena.set_block_pool(pool);
+        void* ptr = arena.alloc(block_size, 1);
+        test_is_zeroed(ptr, block_size);
+    }
+}
+
+TEST_CASE("ArenaResource allocates from its Arena", "[ArenaResource]") {
+    Arena arena(1024);
+    ArenaResource resource(arena);
+
+    std::pmr::vector<int> values(&resource);
+    for (int i = 0; i < 100; i++) {
+        values.push_back(i);
+    }
+    REQUIRE(values.size() == 100);
+    REQUIRE(values[99] == 99);
+    REQUIRE(arena.contains(values.data()));
+    REQUIRE(arena.get_total_used() >= sizeof(int) * 100);
+
+    // Deallocation is a no-op
+    std::size_t used = arena.get_total_used();
+    values.clear();
+    values.shrink_to_fit();
+    REQUIRE(arena.get_total_used() == used);
+
+    REQUIRE(resource.allocate(0) != nullptr);
+    REQUIRE(resource.is_equal(resource));
+    ArenaResource other(arena);
+    REQUIRE_FALSE(resource.is_equal(other));
+}
+
+TEST_CASE("Arena runs destructors of the objects it made", "[Arena]") {
+    struct Tracked {
+        Tracked(std::vector<int>* log, int id) :
+            log(log),
+            id(id) { }
+
+        ~Tracked() { log->push_back(id); }
+
+        std::vector<int>* log;
+        int id;
+    };
+
+    std::vector<int> log;
+
+    SECTION("Trivially destructible objects register nothing") {
+        Arena arena(1024);
+        int* value = arena.make<int>(42);
+        REQUIRE(*value == 42);
+        REQUIRE(arena.get_total_used() == sizeof(int));
+    }
+
+    SECTION("Destructors run in reverse order on reset") {
+        Arena arena(1024);
+        for (int i = 0; i < 3; i++) {
+            Tracked* obj = arena.make<Tracked>(&log, i);
+            REQUIRE(arena.contains(obj));
+        }
+        REQUIRE(log.empty());
+        arena.reset();
+        REQUIRE(log == std::vector<int> { 2, 1, 0 });
+        arena.reset();
+        REQUIRE(log.size() == 3);
+    }
+
+    SECTION("Destructors run when the arena is destroyed") {
+        {
+            Arena arena(64);
+            for (int i = 0; i < 16; i++) {
+                arena.make<Tracked>(&log, i);
+            }
+        }
+        REQUIRE(log.size() == 16);
+        REQUIRE(log.front() == 15);
+        REQUIRE(log.back() == 0);
+    }
+
+    SECTION("Rewinding only destroys objects made after the mark") {
+        Arena arena(64);
+        arena.make<Tracked>(&log, 0);
+        Arena::Mark mark = arena.mark();
+        for (int i = 1; i < 8; i++) {
+            arena.make<Tracked>(&log, i);
+        }
+        arena.rewind(mark);
+        REQUIRE(log == std::vector<int> { 7, 6, 5, 4, 3, 2, 1 });
+        arena.make<Tracked>(&log, 8);
+        arena.reset();
+        REQUIRE(log.back() == 0);
+        REQUIRE(log[log.size() - 2] == 8);
+    }
+
+    SECTION("Objects constructed in place can be owned later") {
+        Arena arena(1024);
+        void* mem = arena.alloc(sizeof(Tracked), alignof(Tracked));
+        arena.make<Tracked>(&log, 0);
+        Tracked* obj = new (mem) Tracked(&log, 1);
+        REQUIRE(arena.own(obj));
+        arena.reset();
+        REQUIRE(log == std::vector<int> { 1, 0 });
+    }
+
+    SECTION("Owned heap storage is released") {
+        Arena arena(1024, ArenaBackend::Reserved);
+        std::vector<int>* values = arena.make<std::vector<int>>(1000, 7);
+        REQUIRE(values->size() == 1000);
+        Arena::Mark mark = arena.mark();
+        arena.make<std::vector<int>>(1000, 8);
+        arena.rewind(mark);
+        REQUIRE((*values)[999] == 7);
+    }
+}
+
+TEST_CASE("Arena can adopt the blocks of another Arena", "[Arena]") {
+    Arena arena(64);
+    int* own = arena.make<int>(1);
+    Arena::Mark mark = arena.mark();
+
+    Arena other(64);
+    std::vector<int*> values;
+    for (int i = 0; i < 32; i++) {
+        values.push_back(other.make<int>(i));
+    }
+    std::size_t used = arena.get_total_used() + other.get_total_used();
+    std::size_t allocated =
+        arena.get_total_allocated() + other.get_total_allocated();
+
+    REQUIRE(arena.adopt(other));
+    REQUIRE(other.get_block_count() == 0);
+    REQUIRE(other.get_total_used() == 0);
+    REQUIRE(arena.get_total_used() == used);
+    REQUIRE(arena.get_total_allocated() == allocated);
+    REQUIRE(*own == 1);
+    for (int i = 0; i < 32; i++) {
+        REQUIRE(arena.contains(values[i]));
+        REQUIRE(*values[i] == i);
+    }
+
+    // The arena keeps allocating after the adopted blocks
+    REQUIRE(arena.alloc(16, 8) != nullptr);
+
+    arena.rewind(mark);
+    REQUIRE(arena.get_total_used() == sizeof(int));
+    REQUIRE_FALSE(arena.contains(values[0]));
+
+    Arena reserved(1024, ArenaBackend::Reserved);
+    if (reserved.get_backend() == ArenaBackend::Reserved) {
+        REQUIRE_FALSE(arena.adopt(reserved));
+        REQUIRE_FALSE(reserved.adopt(arena));
+    }
+}
+
+TEST_CASE("ArenaGroup merges the arenas of worker threads", "[ArenaGroup]") {
+    struct Counted {
+        Counted(std::atomic<int>* count, int value) :
+            count(count),
+            value(value) { }
+
+        ~Counted() { count->fetch_add(1); }
+
+        std::atomic<int>* count;
+        int value;
+    };
+
+    static constexpr int thread_count = 4;
+    static constexpr int objs_per_thread = 1000;
+
+    std::atomic<int> destroyed = 0;
+    {
+        ArenaGroup group(256);
+        std::vector<std::vector<Counted*>> objs(thread_count);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; t++) {
+            threads.emplace_back([&, t]() {
+                Arena& arena = group.create_arena();
+                for (int i = 0; i < objs_per_thread; i++) {
+                    int value = t * objs_per_thread + i;
+                    objs[t].push_back(arena.make<Counted>(&destroyed, value));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        REQUIRE(group.get_arena_count() == thread_count);
+
+        Arena& arena = group.merge();
+        REQUIRE(&arena == &group.get_arena());
+        REQUIRE(group.get_arena_count() == 0);
+        bool all_valid = true;
+        for (int t = 0; t < thread_count; t++) {
+            for (int i = 0; i < objs_per_thread; i++) {
+                if (!arena.contains(objs[t][i]) ||
+                    objs[t][i]->value != t * objs_per_thread + i) {
+                    all_valid = false;
+                }
+            }
+        }
+        REQUIRE(all_valid);
+        REQUIRE(destroyed == 0);
+    }
+    REQUIRE(destroyed == thread_count * objs_per_thread);
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
+#include <ast.h>
+#include <lex.h>
+#include <mem.h>
+#include <parse.h>
+#include <source.h>
+#include <sym.h>
+
+using namespace alvo;
+
+// Counts calls to the global `operator new` for the whole test binary,
+// including the worker threads of `tokenize_parallel`
+static std::atomic<std::size_t> _global_new_count = 0;
+
+void* operator new(std::size_t size) {
+    _global_new_count.fetch_add(1, std::memory_order_relaxed);
+    void* res = std::malloc(size == 0 ? 1 : size);
+    if (res == nullptr) {
+        throw std::bad_alloc();
+    }
+    return res;
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    _global_new_count.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+TEST_CASE("Parser makes no global allocations once warmed up", "[Parser]") {
+    static constexpr std::string_view src =
+        "import root::foo::bar;\n"
+        "Point<T: Show> :: struct { x: T, y: T }\n"
+        "Color :: enum { Red, Green, Blue }\n"
+        "main :: func(argc: int, argv: [string]) -> int {\n"
+        "    let p = struct Point<int> { x: 1, y: 2 };\n"
+        "    let xs: [int] = [1, 2, 3];\n"
+        "    if p.x >>= 2 { return 0; } else { p.y += xs[1]; }\n"
+        "    for x: xs { defer print(x as string); }\n"
+        "    while true { break; }\n"
+        "    return argc * (2 + 3) - 1;\n"
+        "}\n";
+
+    mem::Arena symbol_arena(4096);
+    sym::SymbolTable symbols(symbol_arena);
+    source::SourceFile source(src);
+    lex::Lexer lexer(source, symbols, symbol_arena);
+    lex::TokenBuffer tokens = lexer.tokenize_all();
+    auto count_parse_allocs = [&](mem::Arena& arena) {
+        parse::Parser parser(tokens, arena);
+        std::size_t before = _global_new_count.load(std::memory_order_relaxed);
+        parser.parse_module();
+        return _global_new_count.load(std::memory_order_relaxed) - before;
+    };
+
+    {
+        // The first parse fills the pool and grows the block list of the
+        // arena, whose capacity `reset()` keeps, so the second one reuses
+        // both. Small blocks make the parse span and rewind over several.
+        mem::BlockPool pool(1 << 20);
+        mem::Arena arena(256);
+        arena.set_block_pool(pool);
+        count_parse_allocs(arena);
+        arena.reset();
+        REQUIRE(count_parse_allocs(arena) == 0);
+        REQUIRE(arena.get_block_count() > 1);
+    }
+
+    // The reserved range never allocates, not even on the first parse
+    mem::Arena arena(8192, mem::ArenaBackend::Reserved);
+    if (arena.get_backend() != mem::ArenaBackend::Reserved) {
+        SKIP("Virtual memory reservation is not supported");
+    }
+    REQUIRE(count_parse_allocs(arena) == 0);
+    REQUIRE(arena.get_total_used() > 0);
+}
+
+TEST_CASE("AllocStats account for every byte of the AST", "[Parser]") {
+    // Primary expressions without an operator make no node of their own,
+    // failed index, call and generic param lists are rewound
+    static constexpr std::string_view srcs[] = {
+        "main :: func(argc: int) -> int {\n"
+        "    let x = argc;\n"
+        "    let y = f(x)[0] as int + 1 * 2;\n"
+        "    return -y;\n"
+        "}\n",
+        "main :: func() {\n"
+        "    let y = f(1, 2, 3;\n"
+        "    let z = a[1 2];\n"
+        "    let w = g<int, float;\n"
+        "    let v = h(a[1], g<int>)[0] + x;\n"
+        "}\n",
+    };
+
+    for (std::string_view src : srcs) {
+        mem::Arena symbol_arena(1024);
+        sym::SymbolTable symbols(symbol_arena);
+        source::SourceFile source(src);
+        lex::Lexer lexer(source, symbols, symbol_arena);
+        lex::TokenBuffer tokens = lexer.tokenize_all();
+        mem::Arena arena(8192);
+        ast::util::AllocStats stats;
+        parse::Parser parser(tokens, arena);
+        parser.set_alloc_stats(stats);
+        parser.parse_module();
+
+        REQUIRE(stats.get_total().bytes == arena.get_total_used());
+    }
+}
@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <source.h>
+#include <tok.h>
+
+using namespace alvo;
+
+static bool line_col_is(const source::SourceFile& source, std::uint32_t offset,
+    std::uint32_t l, std::uint32_t c) {
+    source::LineCol line_col = source.line_col(tok::Pos(offset));
+    return line_col.l == l && line_col.c == c;
+}
+
+static bool is_padded(const source::SourceFile& source) {
+    const char* end = source.get_src().data() + source.get_src().size();
+    for (std::size_t i = 0; i < source::PADDING; i++) {
+        if (end[i] != '\0') {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("SourceFile maps offsets to lines and columns", "[SourceFile]") {
+    // "é" and "€" are two and three bytes long but one column wide
+    source::SourceFile source("ab\n\xC3\xA9x\r\n\n\xE2\x82\xAC;");
+
+    REQUIRE(line_col_is(source, 0, 1, 1));
+    REQUIRE(line_col_is(source, 2, 1, 3));
+    REQUIRE(line_col_is(source, 3, 2, 1));
+    REQUIRE(line_col_is(source, 5, 2, 2));
+    REQUIRE(line_col_is(source, 6, 2, 3));
+    REQUIRE(line_col_is(source, 8, 3, 1));
+    REQUIRE(line_col_is(source, 9, 4, 1));
+    REQUIRE(line_col_is(source, 12, 4, 2));
+    // One past the end, where `Eof` sits
+    REQUIRE(line_col_is(source, 13, 4, 3));
+    REQUIRE(source.get_line_count() == 4);
+    REQUIRE(is_padded(source));
+}
+
+TEST_CASE("SourceFile handles empty sources", "[SourceFile]") {
+    source::SourceFile source("");
+    REQUIRE(line_col_is(source, 0, 1, 1));
+    REQUIRE(source.get_line_count() == 1);
+}
+
+// Writes `content` to a fresh file in the temporary directory
+static std::string write_temp_file(
+    std::string_view name, std::string_view content) {
+    std::filesystem::path path =
+        std::filesystem::temp_directory_path() / std::string(name);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), (std::streamsize)content.size());
+    return path.string();
+}
+
+TEST_CASE("SourceFile loads padded files", "[SourceFile]") {
+    std::string small = "main :: func() -> int { return 0; }\n";
+    // Ends exactly on a page boundary, so the padding can't come from the
+    // tail of the last mapped file page
+    std::string paged(4096 * 4, 'x');
+    for (const std::string& content : { small, paged }) {
+        std::string path = write_temp_file("alvo_source_test.alvo", content);
+        source::LoadResult source = source::SourceFile::load(path.c_str());
+        std::remove(path.c_str());
+        REQUIRE(source.has_value());
+        REQUIRE(source->get_src() == content);
+        REQUIRE(is_padded(*source));
+        REQUIRE(source->is_mapped());
+    }
+}
+
+TEST_CASE("SourceFile reads empty and special files", "[SourceFile]") {
+    std::string path = write_temp_file("alvo_source_test_empty.alvo", "");
+    source::LoadResult empty = source::SourceFile::load(path.c_str());
+    std::remove(path.c_str());
+    REQUIRE(empty.has_value());
+    REQUIRE(empty->get_src().empty());
+    REQUIRE(is_padded(*empty));
+    REQUIRE(!empty->is_mapped());
+
+#if defined(__unix__) || defined(__APPLE__)
+    source::LoadResult null = source::SourceFile::load("/dev/null");
+    REQUIRE(null.has_value());
+    REQUIRE(null->get_src().empty());
+    REQUIRE(is_padded(*null));
+    REQUIRE(!null->is_mapped());
+#endif
+
+    source::LoadResult missing =
+        source::SourceFile::load("/nonexistent/alvo_source_test.alvo");
+    REQUIRE(!missing.has_value());
+    REQUIRE(missing.error() == source::LoadError::Open);
+}
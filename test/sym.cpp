@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <mem.h>
+#include <sym.h>
+
+using namespace alvo;
+
+TEST_CASE("SymbolTable interns strings", "[SymbolTable]") {
+    mem::Arena arena(1024);
+    sym::SymbolTable symbols(arena);
+
+    sym::Symbol foo = symbols.intern("foo");
+    sym::Symbol bar = symbols.intern("bar");
+    REQUIRE(!foo.is_null());
+    REQUIRE(foo != bar);
+    REQUIRE(foo.str() == "foo");
+    REQUIRE(bar.str() == "bar");
+    REQUIRE(foo.id() == 0);
+    REQUIRE(bar.id() == 1);
+    REQUIRE(symbols.size() == 2);
+
+    // Interning copies the string
+    std::string str = "foo";
+    REQUIRE(symbols.intern(str) == foo);
+    str[0] = 'g';
+    REQUIRE(foo.str() == "foo");
+    REQUIRE(arena.contains(foo.str().data()));
+
+    REQUIRE(symbols.find("bar") == bar);
+    REQUIRE(symbols.find("baz").is_null());
+    REQUIRE(symbols.get(1) == bar);
+    REQUIRE(symbols.get(2).is_null());
+    REQUIRE(symbols.intern("") != foo);
+    REQUIRE(sym::Symbol().str().empty());
+}
+
+TEST_CASE("SymbolTable keeps symbols stable while growing", "[SymbolTable]") {
+    static constexpr std::size_t count = 10000;
+
+    mem::Arena arena(4096);
+    sym::SymbolTable symbols(arena);
+
+    std::vector<sym::Symbol> syms;
+    for (std::size_t i = 0; i < count; i++) {
+        syms.push_back(symbols.intern("sym_" + std::to_string(i)));
+    }
+    REQUIRE(symbols.size() == count);
+
+    bool all_stable = true;
+    for (std::size_t i = 0; i < count; i++) {
+        std::string str = "sym_" + std::to_string(i);
+        if (symbols.intern(str) != syms[i] || syms[i].str() != str ||
+            syms[i].id() != i || symbols.get(i) != syms[i]) {
+            all_stable = false;
+        }
+    }
+    REQUIRE(all_stable);
+    REQUIRE(symbols.size() == count);
+    REQUIRE(std::hash<sym::Symbol>()(syms[1]) !=
+            std::hash<sym::Symbol>()(syms[2]));
+}
@@ -0,0 +1,264 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <utf8.h>
+#include <utf8_tables.h>
+
+using namespace alvo;
+
+static std::vector<utf8::Codepoint> decode_all(std::string_view str) {
+    std::vector<utf8::Codepoint> res;
+    utf8::Utf8Iter it(str);
+    while (!it.eof()) {
+        res.push_back(it.next().value());
+    }
+    return res;
+}
+
+TEST_CASE("Can find the ASCII prefix of a string", "[utf8]") {
+    REQUIRE(utf8::ascii_prefix_length("") == 0);
+    REQUIRE(utf8::ascii_prefix_length("abc") == 3);
+    REQUIRE(utf8::ascii_prefix_length("\xC3\xA9") == 0);
+
+    // Every position of the first non-ASCII byte, across SIMD widths and
+    // the scalar tail
+    for (std::size_t size = 1; size < 100; size++) {
+        for (std::size_t pos = 0; pos <= size; pos++) {
+            std::string str(size, 'a');
+            if (pos < size) {
+                str[pos] = '\x80';
+            }
+            if (utf8::ascii_prefix_length(str) != pos) {
+                FAIL("size " << size << ", non-ASCII byte at " << pos);
+            }
+        }
+    }
+
+    // Unaligned starts, so that runs cross 16 and 32 byte boundaries of
+    // memory as well as of the view
+    std::string buf(160, 'a');
+    for (std::size_t offset = 1; offset <= 32; offset++) {
+        for (std::size_t pos = 0; pos <= 100; pos++) {
+            std::string str = buf;
+            if (pos < 100) {
+                str[offset + pos] = '\xC3';
+            }
+            std::string_view view(str.data() + offset, 100);
+            if (utf8::ascii_prefix_length(view) != pos) {
+                FAIL("offset " << offset << ", non-ASCII byte at " << pos);
+            }
+        }
+    }
+}
+
+TEST_CASE("quoted_run_length stops at bytes a quoted literal inspects",
+    "[utf8]") {
+    REQUIRE(utf8::quoted_run_length("", '"') == 0);
+    REQUIRE(utf8::quoted_run_length("ab'c", '"') == 4);
+    REQUIRE(utf8::quoted_run_length("ab'c", '\'') == 2);
+    REQUIRE(utf8::quoted_run_length("a\\n", '"') == 1);
+
+    // Every position of each kind of stop byte, across SIMD widths and the
+    // scalar tail
+    for (char stop : { '"', '\\', '\n', '\x7F', '\x80', '\xFF' }) {
+        for (std::size_t size = 1; size < 100; size++) {
+            for (std::size_t pos = 0; pos <= size; pos++) {
+                std::string str(size, 'a');
+                if (pos < size) {
+                    str[pos] = stop;
+                }
+                if (utf8::quoted_run_length(str, '"') != pos) {
+                    FAIL("size " << size << ", byte " << int(stop) << " at "
+                                 << pos);
+                }
+            }
+        }
+    }
+
+    // Unaligned starts, so that runs cross 16 and 32 byte boundaries of
+    // memory as well as of the view
+    std::string buf(160, 'a');
+    for (char stop : { '\'', '\\', '\t', '\xC3' }) {
+        for (std::size_t offset = 1; offset <= 32; offset++) {
+            for (std::size_t pos = 0; pos <= 100; pos++) {
+                std::string str = buf;
+                if (pos < 100) {
+                    str[offset + pos] = stop;
+                }
+                std::string_view view(str.data() + offset, 100);
+                if (utf8::quoted_run_length(view, '\'') != pos) {
+                    FAIL("offset " << offset << ", byte " << int(stop)
+                                   << " at " << pos);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Utf8Iter decodes mixed ASCII and multibyte text", "[utf8]") {
+    std::string str;
+    std::vector<utf8::Codepoint> expected;
+    for (int i = 0; i < 200; i++) {
+        str += "ident_";
+        for (char c : std::string_view("ident_")) {
+            expected.push_back(c);
+        }
+        // U+00E9, U+20AC and U+1F600
+        str += "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+        expected.push_back(0x00E9);
+        expected.push_back(0x20AC);
+        expected.push_back(0x1F600);
+    }
+    REQUIRE(decode_all(str) == expected);
+
+    utf8::Utf8Iter it("a\xC3\xA9" "b");
+    REQUIRE(it.byte_offset() == 1);
+    REQUIRE(it.peek() == 'a');
+    // Looking ahead doesn't move
+    REQUIRE(it.peek(1) == 0x00E9);
+    REQUIRE(it.peek(2) == 'b');
+    REQUIRE(it.peek(3) == std::nullopt);
+    REQUIRE(it.byte_offset() == 1);
+    REQUIRE(it.next() == 'a');
+    REQUIRE(it.byte_offset() == 3);
+    REQUIRE(it.next() == 0x00E9);
+    REQUIRE(it.byte_offset() == 4);
+    REQUIRE(it.next() == 'b');
+    REQUIRE(it.eof());
+    REQUIRE(it.next() == std::nullopt);
+}
+
+TEST_CASE("Utf8Iter reads the sentinel after the view", "[utf8]") {
+    // `std::string` keeps a NUL after its characters
+    std::string str = "a\xC3\xA9" + std::string(40, 'b');
+    utf8::Utf8Iter it(str, str.size(), true);
+    REQUIRE(it.peek(42) == 0);
+    REQUIRE(it.peek(43) == std::nullopt);
+    REQUIRE(it.next() == 'a');
+    REQUIRE(it.next() == 0x00E9);
+    for (int i = 0; i < 40; i++) {
+        REQUIRE(it.next() == 'b');
+    }
+    REQUIRE(it.byte_offset() == str.size() + 1);
+    REQUIRE(it.next() == 0);
+    REQUIRE(it.eof());
+    REQUIRE(it.next() == std::nullopt);
+
+    utf8::Utf8Iter empty(std::string_view(""), 0, true);
+    REQUIRE(empty.next() == 0);
+    REQUIRE(empty.next() == std::nullopt);
+}
+
+TEST_CASE("Utf8Iter stops at invalid UTF-8", "[utf8]") {
+    REQUIRE(utf8::Utf8Iter("ab\xFF", 2).peek(2) == std::nullopt);
+    REQUIRE(decode_all("ab\xFF" "cd") == std::vector<utf8::Codepoint> {
+                                            'a', 'b' });
+    REQUIRE(decode_all("ab\xC3") == std::vector<utf8::Codepoint> { 'a', 'b' });
+    REQUIRE(decode_all("\xED\xA0\x80").empty());
+}
+
+TEST_CASE("Can find the valid UTF-8 prefix of a string", "[utf8]") {
+    REQUIRE(utf8::valid_prefix_length("") == 0);
+    REQUIRE(utf8::valid_prefix_length("abc") == 3);
+    REQUIRE(utf8::valid_prefix_length("a\xC3\xA9" "b\xF0\x9F\x98\x80") == 8);
+    // Truncated sequence
+    REQUIRE(utf8::valid_prefix_length("ab\xE2\x82") == 2);
+    // Stray continuation byte
+    REQUIRE(utf8::valid_prefix_length("abc\x80" "def") == 3);
+    // Overlong encoding of '/'
+    REQUIRE(utf8::valid_prefix_length("a\xC0\xAF") == 1);
+    // Surrogate
+    REQUIRE(utf8::valid_prefix_length("ab\xED\xA0\x80") == 2);
+    // Above U+10FFFF
+    REQUIRE(utf8::valid_prefix_length("\xF4\x90\x80\x80") == 0);
+
+    std::string long_str(1000, 'a');
+    long_str += "\xC3\xA9";
+    long_str += std::string(1000, 'b');
+    REQUIRE(utf8::valid_prefix_length(long_str) == long_str.size());
+    long_str[1500] = '\xFF';
+    REQUIRE(utf8::valid_prefix_length(long_str) == 1500);
+}
+
+TEST_CASE("Utf8Iter decodes validated text without checks", "[utf8]") {
+    std::string str;
+    for (int i = 0; i < 100; i++) {
+        str += "x = '\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80';\n";
+    }
+    std::size_t valid_size = utf8::valid_prefix_length(str);
+    REQUIRE(valid_size == str.size());
+
+    utf8::Utf8Iter checked(str);
+    utf8::Utf8Iter unchecked(str, valid_size);
+    bool all_equal = true;
+    while (!checked.eof()) {
+        if (checked.next() != unchecked.next() ||
+            checked.byte_offset() != unchecked.byte_offset()) {
+            all_equal = false;
+        }
+    }
+    REQUIRE(all_equal);
+    REQUIRE(unchecked.eof());
+
+    // Bytes past the valid prefix are still checked
+    std::string_view invalid = "ab\xFF";
+    utf8::Utf8Iter it(invalid, utf8::valid_prefix_length(invalid));
+    REQUIRE(it.next() == 'a');
+    REQUIRE(it.next() == 'b');
+    REQUIRE(it.eof());
+}
+
+// Count and FNV-1a hash of every codepoint with the property, so that a
+// regenerated table can't silently drop or gain a codepoint
+static std::pair<std::size_t, std::uint64_t> property_checksum(
+    bool (*pred)(utf8::Codepoint)) {
+    std::size_t count = 0;
+    std::uint64_t hash = 14695981039346656037ull;
+    for (utf8::Codepoint c = 0; c < 0x110000; c++) {
+        if (pred(c)) {
+            count++;
+            hash = (hash ^ (std::uint64_t)c) * 1099511628211ull;
+        }
+    }
+    return { count, hash };
+}
+
+TEST_CASE("Unicode property tables match Unicode 16.0", "[utf8]") {
+    REQUIRE(property_checksum(utf8::is_alpha) ==
+        std::pair<std::size_t, std::uint64_t>(142759, 0x8876fd6512eb5d44));
+    REQUIRE(property_checksum(utf8::is_upper) ==
+        std::pair<std::size_t, std::uint64_t>(1978, 0x2475590b62cab912));
+    REQUIRE(property_checksum(utf8::is_lower) ==
+        std::pair<std::size_t, std::uint64_t>(2569, 0x2185094a38b193c0));
+
+    REQUIRE(utf8::is_alpha('a'));
+    REQUIRE(utf8::is_alpha(0x4E00));
+    REQUIRE(!utf8::is_alpha('1'));
+    REQUIRE(utf8::is_upper(0x0391));
+    REQUIRE(utf8::is_lower(0x03B1));
+
+    for (utf8::Codepoint c : { -1, 0x110000, 0x7FFFFFFF }) {
+        REQUIRE(!utf8::is_alpha(c));
+        REQUIRE(!utf8::is_upper(c));
+        REQUIRE(!utf8::is_lower(c));
+    }
+}
+
+TEST_CASE("Unicode properties end with the last table block", "[utf8]") {
+    constexpr utf8::Codepoint block_size = 1 << utf8::tables::BLOCK_SHIFT;
+    constexpr utf8::Codepoint end = utf8::tables::CODEPOINT_COUNT;
+    // The last block, the codepoint right after it and the whole block that
+    // would follow it
+    for (utf8::Codepoint c = end - block_size; c < end + block_size; c++) {
+        REQUIRE(!utf8::is_alpha(c));
+        REQUIRE(!utf8::is_upper(c));
+        REQUIRE(!utf8::is_lower(c));
+    }
+}
@@ -0,0 +1,37 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+#include <util.h>
+
+using namespace alvo;
+
+namespace {
+    int twice(int x) { return 2 * x; }
+}
+
+TEST_CASE("FunctionRef calls the callable it refers to", "[util]") {
+    int calls = 0;
+    auto add = [&](int x) {
+        calls++;
+        return x + calls;
+    };
+    util::FunctionRef<int(int)> ref(add);
+    REQUIRE(ref(10) == 11);
+    REQUIRE(ref(10) == 12);
+
+    // Copies refer to the same callable
+    util::FunctionRef<int(int)> copy = ref;
+    REQUIRE(copy(10) == 13);
+    REQUIRE(calls == 3);
+
+    const auto constant = [](int) { return 7; };
+    REQUIRE(util::FunctionRef<int(int)>(constant)(0) == 7);
+
+    auto twice_ptr = &twice;
+    REQUIRE(util::FunctionRef<int(int)>(twice_ptr)(4) == 8);
+
+    // A temporary would dangle, so only lvalues bind
+    STATIC_REQUIRE(!std::is_constructible_v<util::FunctionRef<int(int)>,
+                   decltype([](int x) { return x; })>);
+}
@@ -0,0 +1,8 @@
+#!/bin/sh
+
+# Usage: ./run.sh <path to `DerivedCoreProperties.txt`>
+# The tables in the tree are generated from Unicode 16.0.0.
+
+python3 unigen.py \
+    --properties-file "$1" \
+    --output-file ../src/utf8_tables.h
@@ -0,0 +1,164 @@
+import argparse
+from io import StringIO
+from dataclasses import dataclass
+from typing import Dict, List, Set
+
+# Codepoints covered by every table
+CODEPOINT_COUNT = 0x110000
+# Codepoints per second-stage block, one bit each
+BLOCK_SIZE = 256
+WORDS_PER_BLOCK = BLOCK_SIZE // 64
+
+OUTPUT_WIDTH = 80
+
+
+@dataclass
+class Property:
+    # Property name in `DerivedCoreProperties.txt`
+    name: str
+    # Prefix of the generated table names
+    prefix: str
+
+
+PROPERTIES = [
+    Property(name="Alphabetic", prefix="ALPHA"),
+    Property(name="Uppercase", prefix="UPPER"),
+    Property(name="Lowercase", prefix="LOWER"),
+]
+
+
+@dataclass
+class Table:
+    prop: Property
+    index: List[int]
+    blocks: List[List[int]]
+
+
+def parse_properties(data: str) -> Dict[str, Set[int]]:
+    res: Dict[str, Set[int]] = {}
+    for line in data.splitlines():
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        codepoints, name = [part.strip() for part in line.split(";", 1)]
+        if ".." in codepoints:
+            first, last = codepoints.split("..")
+        else:
+            first, last = codepoints, codepoints
+        res.setdefault(name, set()).update(range(int(first, 16), int(last, 16) + 1))
+    return res
+
+
+def build_table(prop: Property, codepoints: Set[int]) -> Table:
+    index: List[int] = []
+    blocks: List[List[int]] = []
+    block_ids: Dict[tuple, int] = {}
+    for block_start in range(0, CODEPOINT_COUNT, BLOCK_SIZE):
+        words = [0] * WORDS_PER_BLOCK
+        for c in range(block_start, block_start + BLOCK_SIZE):
+            if c in codepoints:
+                bit = c - block_start
+                words[bit // 64] |= 1 << (bit % 64)
+        key = tuple(words)
+        if key not in block_ids:
+            block_ids[key] = len(blocks)
+            blocks.append(words)
+        index.append(block_ids[key])
+    return Table(prop=prop, index=index, blocks=blocks)
+
+
+@dataclass
+class Generator:
+    out: StringIO
+    tables: List[Table]
+
+    def __init__(self, tables: List[Table]):
+        self.out = StringIO()
+        self.tables = tables
+
+    def generate(self) -> str:
+        self.out = StringIO()
+        self._gen_heading()
+        self.out.write("#pragma once\n\n")
+        self.out.write("#include <cstdint>\n\n")
+        self.out.write("namespace alvo::utf8::tables {\n\n")
+        self.out.write(f"    inline constexpr int CODEPOINT_COUNT = 0x{CODEPOINT_COUNT:X};\n")
+        self.out.write(f"    inline constexpr int BLOCK_SHIFT = {BLOCK_SIZE.bit_length() - 1};\n")
+        self.out.write(
+            f"    inline constexpr int INDEX_SIZE = {CODEPOINT_COUNT // BLOCK_SIZE};\n"
+        )
+        self.out.write(f"    inline constexpr int WORDS_PER_BLOCK = {WORDS_PER_BLOCK};\n")
+        for table in self.tables:
+            self.out.write("\n")
+            self._gen_table(table)
+        self.out.write("\n}\n")
+        return self.out.getvalue()
+
+    def _gen_heading(self):
+        self.out.write("// This file is generated using `unigen.py`.    /\n")
+        self.out.write("// DO NOT EDIT BY HAND!                         /\n")
+        self.out.write("//                                              /\n")
+        self.out.write("// Note: regenerate it from the Unicode         /\n")
+        self.out.write("// Character Database, see `unigen/run.sh`.     /\n")
+        self.out.write("\n")
+
+    def _gen_values(self, values: List[str], indent: int, cont_indent: int):
+        line = " " * indent
+        for i, value in enumerate(values):
+            item = value + ("," if i < len(values) - 1 else "")
+            if line.strip() and len(line) + 1 + len(item) > OUTPUT_WIDTH:
+                self.out.write(line + "\n")
+                line = " " * cont_indent
+            line += (" " if line.strip() else "") + item
+        self.out.write(line + "\n")
+
+    def _gen_table(self, table: Table):
+        prefix = table.prop.prefix
+        index_type = "std::uint8_t" if len(table.blocks) <= 0x100 else "std::uint16_t"
+
+        self.out.write(f"    // `{table.prop.name}`, block of every {BLOCK_SIZE} codepoints\n")
+        self.out.write(
+            f"    inline constexpr {index_type} {prefix}_INDEX[INDEX_SIZE] = {{\n"
+        )
+        self._gen_values([str(i) for i in table.index], 8, 8)
+        self.out.write("    };\n\n")
+
+        self.out.write(f"    // `{table.prop.name}`, one bit per codepoint\n")
+        self.out.write(
+            f"    inline constexpr std::uint64_t {prefix}_BLOCKS[{len(table.blocks)}][WORDS_PER_BLOCK] = {{\n"
+        )
+        for block in table.blocks:
+            words = [f"0x{word:016x}" for word in block]
+            words[0] = "{ " + words[0]
+            words[-1] += " },"
+            self._gen_values(words, 8, 12)
+        self.out.write("    };\n")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        prog="unigen", description="Unicode property table generator"
+    )
+    parser.add_argument(
+        "-p",
+        "--properties-file",
+        required=True,
+        help="path to `DerivedCoreProperties.txt` of the Unicode Character Database",
+    )
+    parser.add_argument(
+        "-o", "--output-file", required=True, help="path of the generated header"
+    )
+
+    args = parser.parse_args()
+
+    with open(args.properties_file, "r") as properties_file:
+        properties = parse_properties(properties_file.read())
+
+    tables = []
+    for prop in PROPERTIES:
+        if prop.name not in properties:
+            raise Exception(f"Property `{prop.name}` not found")
+        tables.append(build_table(prop, properties[prop.name]))
+
+    with open(args.output_file, "w") as output_file:
+        output_file.write(Generator(tables).generate())